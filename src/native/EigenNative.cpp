@@ -2,6 +2,7 @@
 
 #include "EigenNative.h"
 #include <Eigen/Core>
+#include <Eigen/Dense>
 #include <Eigen/Eigenvalues>
 #include <Eigen/Sparse>
 #include <unsupported/Eigen/IterativeSolvers>
@@ -9,143 +10,857 @@
 using namespace std;
 using namespace Eigen;
 
+// Instrumentation: call count, total/min/max time and a latency histogram for every export,
+// bucketed by problem size. The hot path takes no lock and no atomic read-modify-write: each
+// thread records into its own block, which only it writes, and a snapshot sums the blocks of
+// all threads. The registry mutex is taken when a thread makes its first call, when it exits
+// and when counters are read. A reset bumps the epoch; every thread clears its own block on
+// its next call and readers skip blocks of an older epoch. EIGEN_CORE_INSTRUMENTATION=0
+// compiles the counters out, the exports then report nothing.
+#ifndef EIGEN_CORE_INSTRUMENTATION
+#define EIGEN_CORE_INSTRUMENTATION 1
+#endif
+
+// must match EigenCore.Diagnostics.EigenDiagnostics.
+static const int instrument_max_entry_points = 256;
+// problem size in [4^k, 4^(k+1)), bucket 0 below 4 and the last one open-ended.
+static const int instrument_size_buckets = 16;
+// latency in [2^k, 2^(k+1)) microseconds, bucket 0 below 2 us and the last one open-ended.
+static const int instrument_latency_buckets = 32;
+
+// counters of one export and size bucket, written by a single thread.
+struct InstrumentCell
+{
+	atomic<uint64_t> count{ 0 };
+	atomic<uint64_t> totalNs{ 0 };
+	atomic<uint64_t> minNs{ UINT64_MAX };
+	atomic<uint64_t> maxNs{ 0 };
+	atomic<uint64_t> histogram[instrument_latency_buckets] = {};
+
+	// owner only, a plain load and store is enough with a single writer.
+	static void add(atomic<uint64_t>& counter, uint64_t value)
+	{
+		counter.store(counter.load(memory_order_relaxed) + value, memory_order_relaxed);
+	}
+
+	void record(uint64_t ns, int latencyBucket)
+	{
+		add(count, 1);
+		add(totalNs, ns);
+		if (ns < minNs.load(memory_order_relaxed))
+			minNs.store(ns, memory_order_relaxed);
+		if (ns > maxNs.load(memory_order_relaxed))
+			maxNs.store(ns, memory_order_relaxed);
+		add(histogram[latencyBucket], 1);
+	}
+
+	void merge(const InstrumentCell& other)
+	{
+		add(count, other.count.load(memory_order_relaxed));
+		add(totalNs, other.totalNs.load(memory_order_relaxed));
+		minNs.store(std::min(minNs.load(memory_order_relaxed), other.minNs.load(memory_order_relaxed)), memory_order_relaxed);
+		maxNs.store(std::max(maxNs.load(memory_order_relaxed), other.maxNs.load(memory_order_relaxed)), memory_order_relaxed);
+		for (int k = 0; k < instrument_latency_buckets; ++k)
+			add(histogram[k], other.histogram[k].load(memory_order_relaxed));
+	}
+
+	void clear()
+	{
+		count.store(0, memory_order_relaxed);
+		totalNs.store(0, memory_order_relaxed);
+		minNs.store(UINT64_MAX, memory_order_relaxed);
+		maxNs.store(0, memory_order_relaxed);
+		for (auto& bucket : histogram)
+			bucket.store(0, memory_order_relaxed);
+	}
+};
+
+// cells of one thread, allocated on first use and published to readers with release.
+struct InstrumentBlock
+{
+	static const int size = instrument_max_entry_points * instrument_size_buckets;
+
+	atomic<uint32_t> epoch{ 0 };
+	atomic<InstrumentCell*> cells[size] = {};
+
+	~InstrumentBlock()
+	{
+		for (auto& cell : cells)
+			delete cell.load(memory_order_relaxed);
+	}
+
+	InstrumentCell& cell(int index)
+	{
+		InstrumentCell* cell = cells[index].load(memory_order_relaxed);
+		if (cell == nullptr)
+		{
+			cell = new InstrumentCell();
+			cells[index].store(cell, memory_order_release);
+		}
+
+		return *cell;
+	}
+
+	void clear()
+	{
+		for (auto& cell : cells)
+		{
+			InstrumentCell* current = cell.load(memory_order_relaxed);
+			if (current != nullptr)
+				current->clear();
+		}
+	}
+
+	void merge(InstrumentBlock& other)
+	{
+		for (int index = 0; index < size; ++index)
+		{
+			const InstrumentCell* current = other.cells[index].load(memory_order_acquire);
+			if (current != nullptr && current->count.load(memory_order_relaxed) > 0)
+				cell(index).merge(*current);
+		}
+	}
+};
+
+class InstrumentRegistry
+{
+public:
+	atomic<bool> enabled{ EIGEN_CORE_INSTRUMENTATION != 0 };
+	atomic<uint32_t> epoch{ 0 };
+
+	int register_entry_point(const char* name)
+	{
+		lock_guard<mutex> guard(lock);
+		if (entryPoints.size() == static_cast<size_t>(instrument_max_entry_points))
+			return -1;
+		entryPoints.push_back(name);
+		return static_cast<int>(entryPoints.size()) - 1;
+	}
+
+	InstrumentBlock* attach()
+	{
+		InstrumentBlock* block = new InstrumentBlock();
+		lock_guard<mutex> guard(lock);
+		block->epoch.store(epoch.load(memory_order_relaxed), memory_order_relaxed);
+		blocks.push_back(block);
+		return block;
+	}
+
+	// keeps the counts of an exiting thread.
+	void detach(InstrumentBlock* block)
+	{
+		lock_guard<mutex> guard(lock);
+		if (block->epoch.load(memory_order_relaxed) == epoch.load(memory_order_relaxed))
+			retired.merge(*block);
+		blocks.erase(find(blocks.begin(), blocks.end(), block));
+		delete block;
+	}
+
+	void reset()
+	{
+		lock_guard<mutex> guard(lock);
+		epoch.fetch_add(1, memory_order_relaxed);
+		retired.clear();
+	}
+
+	// sum of the blocks of the current epoch, a call racing the copy may be missed or counted twice
+	// in min/max, never torn within a counter.
+	void snapshot(InstrumentBlock& total, vector<const char*>& names)
+	{
+		lock_guard<mutex> guard(lock);
+		const uint32_t current = epoch.load(memory_order_relaxed);
+		total.merge(retired);
+		for (InstrumentBlock* block : blocks)
+		{
+			if (block->epoch.load(memory_order_acquire) == current)
+				total.merge(*block);
+		}
+
+		names = entryPoints;
+	}
+
+private:
+	mutex lock;
+	vector<const char*> entryPoints;
+	vector<InstrumentBlock*> blocks;
+	InstrumentBlock retired;
+};
+
+// never destroyed, threads exiting during process shutdown still detach from it.
+static InstrumentRegistry& instrument_registry()
+{
+	static InstrumentRegistry* registry = new InstrumentRegistry();
+	return *registry;
+}
+
+struct InstrumentThread
+{
+	InstrumentBlock* block = nullptr;
+
+	~InstrumentThread()
+	{
+		if (block != nullptr)
+			instrument_registry().detach(block);
+	}
+};
+
+static thread_local InstrumentThread instrument_thread;
+
+static int instrument_size_bucket(uint64_t size)
+{
+	int log2 = 0;
+	while (size >>= 1)
+		++log2;
+	return std::min(log2 / 2, instrument_size_buckets - 1);
+}
+
+static int instrument_latency_bucket(uint64_t ns)
+{
+	uint64_t microseconds = ns / 1000;
+	int log2 = 0;
+	while (microseconds >>= 1)
+		++log2;
+	return std::min(log2, instrument_latency_buckets - 1);
+}
+
+static void instrument_record(int entryPoint, uint64_t size, uint64_t ns)
+{
+	InstrumentRegistry& registry = instrument_registry();
+	InstrumentBlock* block = instrument_thread.block;
+	if (block == nullptr)
+		block = instrument_thread.block = registry.attach();
+
+	const uint32_t epoch = registry.epoch.load(memory_order_relaxed);
+	if (block->epoch.load(memory_order_relaxed) != epoch)
+	{
+		block->clear();
+		block->epoch.store(epoch, memory_order_release);
+	}
+
+	block->cell(entryPoint * instrument_size_buckets + instrument_size_bucket(size))
+		.record(ns, instrument_latency_bucket(ns));
+}
+
+// times the enclosing export, the problem size is nnz for sparse inputs and rows * cols otherwise.
+class InstrumentScope
+{
+public:
+	InstrumentScope(int entryPoint, long long rows, long long cols, long long nnz)
+		: entryPoint(entryPoint), active(entryPoint >= 0 && instrument_registry().enabled.load(memory_order_relaxed))
+	{
+		if (active)
+		{
+			resize(rows, cols, nnz);
+			start = chrono::steady_clock::now();
+		}
+	}
+
+	~InstrumentScope()
+	{
+		if (active)
+			instrument_record(entryPoint, size, chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+	}
+
+	// for exports that only learn the size while running, e.g. file readers.
+	void resize(long long rows, long long cols, long long nnz)
+	{
+		size = static_cast<uint64_t>(nnz > 0 ? nnz : std::max(0LL, rows) * std::max(0LL, cols));
+	}
+
+private:
+	int entryPoint;
+	bool active;
+	uint64_t size = 0;
+	chrono::steady_clock::time_point start;
+};
+
+#if EIGEN_CORE_INSTRUMENTATION
+#define INSTRUMENT_EXPORT(rows, cols, nnz) \
+	static const int instrument_entry_point = instrument_registry().register_entry_point(__func__); \
+	InstrumentScope instrument_scope(instrument_entry_point, rows, cols, nnz)
+#define INSTRUMENT_RESIZE(rows, cols, nnz) instrument_scope.resize(rows, cols, nnz)
+#else
+#define INSTRUMENT_EXPORT(rows, cols, nnz)
+#define INSTRUMENT_RESIZE(rows, cols, nnz)
+#endif
+
+// counters of one export and size bucket in a snapshot.
+struct InstrumentSnapshotEntry
+{
+	const char* name;
+	int sizeBucket;
+	const InstrumentCell* cell;
+};
+
+class InstrumentSnapshot
+{
+public:
+	InstrumentSnapshot()
+	{
+		instrument_registry().snapshot(total, names);
+		for (int entryPoint = 0; entryPoint < static_cast<int>(names.size()); ++entryPoint)
+		{
+			for (int sizeBucket = 0; sizeBucket < instrument_size_buckets; ++sizeBucket)
+			{
+				const InstrumentCell* cell = total.cells[entryPoint * instrument_size_buckets + sizeBucket].load(memory_order_relaxed);
+				if (cell != nullptr && cell->count.load(memory_order_relaxed) > 0)
+					entries.push_back({ names[entryPoint], sizeBucket, cell });
+			}
+		}
+	}
+
+	InstrumentBlock total;
+	vector<const char*> names;
+	vector<InstrumentSnapshotEntry> entries;
+};
+
+// counters are on unless EIGEN_CORE_INSTRUMENTATION is 0, disabling skips the two clock reads per call.
+EXPORT_API(void) instrumentation_set_enabled_(bool enabled)
+{
+	instrument_registry().enabled.store(enabled && EIGEN_CORE_INSTRUMENTATION != 0, memory_order_relaxed);
+}
+
+EXPORT_API(bool) instrumentation_enabled_()
+{
+	return instrument_registry().enabled.load(memory_order_relaxed);
+}
+
+// clears the counters of every thread.
+EXPORT_API(void) instrumentation_reset_()
+{
+	instrument_registry().reset();
+}
+
+// merges the counters of every thread, returns a handle with one entry per export and size bucket called.
+EXPORT_API(void*) instrumentation_snapshot_(_Out_ int* count)
+{
+	InstrumentSnapshot* snapshot = new InstrumentSnapshot();
+	*count = static_cast<int>(snapshot->entries.size());
+	return snapshot;
+}
+
+// stats receives count, total, min and max nanoseconds, histogram instrument_latency_buckets counts.
+EXPORT_API(const char*) instrumentation_snapshot_entry_(_In_ void* handle, int index, _Out_ int* sizeBucket, _Out_ long long* stats, _Out_ long long* histogram)
+{
+	const InstrumentSnapshotEntry& entry = static_cast<const InstrumentSnapshot*>(handle)->entries[index];
+	*sizeBucket = entry.sizeBucket;
+	stats[0] = static_cast<long long>(entry.cell->count.load(memory_order_relaxed));
+	stats[1] = static_cast<long long>(entry.cell->totalNs.load(memory_order_relaxed));
+	stats[2] = static_cast<long long>(entry.cell->minNs.load(memory_order_relaxed));
+	stats[3] = static_cast<long long>(entry.cell->maxNs.load(memory_order_relaxed));
+	for (int k = 0; k < instrument_latency_buckets; ++k)
+		histogram[k] = static_cast<long long>(entry.cell->histogram[k].load(memory_order_relaxed));
+	return entry.name;
+}
+
+EXPORT_API(void) instrumentation_snapshot_destroy_(_In_ void* handle)
+{
+	delete static_cast<InstrumentSnapshot*>(handle);
+}
+
+// Thread budget shared by every export. Eigen's own setNbThreads is process-wide and takes
+// precedence over anything set per thread, so the budget is kept here and handed to Eigen
+// through the calling thread's OpenMP nthreads ICV, which Eigen::nbThreads() falls back to.
+// A per-thread override lets a service keep small concurrent calls single-threaded.
+static int default_num_threads()
+{
+#ifdef EIGEN_HAS_OPENMP
+	static const int initial = omp_get_max_threads();
+	return initial;
+#else
+	return 1;
+#endif
+}
+
+static atomic<int> num_threads(0);
+static thread_local int thread_budget = 0;
+
+static int effective_num_threads()
+{
+	if (thread_budget > 0)
+		return thread_budget;
+	int threads = num_threads.load(memory_order_relaxed);
+	return threads > 0 ? threads : default_num_threads();
+}
+
+// applies the effective budget to the calling thread before Eigen decides how many threads to use.
+static inline void apply_thread_budget()
+{
+#ifdef EIGEN_HAS_OPENMP
+	int threads = effective_num_threads();
+	if (omp_get_max_threads() != threads)
+		omp_set_num_threads(threads);
+#endif
+}
+
+// sets the process-wide number of threads, threads <= 0 restores the OpenMP default.
+EXPORT_API(void) set_num_threads_(const int threads)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	Eigen::initParallel();
+	num_threads.store(threads > 0 ? threads : 0, memory_order_relaxed);
+}
+
+// number of threads Eigen will use for a call made from the calling thread.
+EXPORT_API(int) get_num_threads_()
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	apply_thread_budget();
+	return Eigen::nbThreads();
+}
+
+// overrides the number of threads for calls made from the calling thread, threads <= 0 clears the override.
+EXPORT_API(void) set_thread_budget_(const int threads)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	thread_budget = threads > 0 ? threads : 0;
+}
+
+EXPORT_API(int) get_thread_budget_()
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return thread_budget;
+}
+
+// instruction sets Eigen was compiled for in this build, e.g. "AVX2, AVX, SSE, ...".
+EXPORT_API(const char*) simd_instruction_sets_in_use_()
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return Eigen::SimdInstructionSetsInUse();
+}
+
+// must match the variants picked by EigenCore.Eigen.NativeLibraryResolver.
+enum InstructionSetLevel
+{
+	SSE2Level = 0,
+	AVX2Level = 1,
+	AVX512Level = 2
+};
+
+// highest eigen_core variant the host cpu and os can run, queried on the baseline build
+// before loading eigen_core_avx2 or eigen_core_avx512.
+EXPORT_API(int) simd_supported_level_()
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+#if defined _MSC_VER && (defined _M_X64 || defined _M_IX86)
+	int info[4];
+	__cpuid(info, 0);
+	const int maxLeaf = info[0];
+	__cpuid(info, 1);
+	const bool fma = (info[2] & (1 << 12)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	if (maxLeaf < 7 || !osxsave)
+		return SSE2Level;
+
+	// the os must save the ymm (bits 1-2) and zmm/opmask (bits 5-7) registers.
+	const unsigned long long xcr0 = _xgetbv(0);
+	__cpuidex(info, 7, 0);
+	const bool avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+	const bool avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 17)) != 0 && (xcr0 & 0xe6) == 0xe6;
+	if (avx2 && fma && avx512)
+		return AVX512Level;
+	return avx2 && fma ? AVX2Level : SSE2Level;
+#elif (defined __GNUC__ || defined __clang__) && (defined __x86_64__ || defined __i386__)
+	// __builtin_cpu_supports also checks that the os enabled the extended registers.
+	__builtin_cpu_init();
+	const bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+	if (avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+		return AVX512Level;
+	return avx2 ? AVX2Level : SSE2Level;
+#else
+	return SSE2Level;
+#endif
+}
+
+// Kernels below are templated on the scalar type, the d* exports run them on
+// double and the f* exports on float.
+template<typename Scalar>
+using DenseVector = Matrix<Scalar, Dynamic, 1>;
+
+template<typename Scalar>
+using DenseMatrix = Matrix<Scalar, Dynamic, Dynamic>;
+
+template<typename Scalar>
+static Scalar dense_dot(const Scalar* v1, const Scalar* v2, int length)
+{
+	Map<const DenseVector<Scalar>> first(v1, length);
+	Map<const DenseVector<Scalar>> second(v2, length);
+	return first.dot(second);
+}
+
+template<typename Scalar>
+static void dense_add(const Scalar* v1, const Scalar* v2, int length, Scalar* vout)
+{
+	Map<const DenseVector<Scalar>> first(v1, length);
+	Map<const DenseVector<Scalar>> second(v2, length);
+	Map<DenseVector<Scalar>> result(vout, length);
+	result = first + second;
+}
+
+template<typename Scalar>
+static void dense_scale(const Scalar* v1, Scalar scale, int length, Scalar* vout)
+{
+	Map<const DenseVector<Scalar>> first(v1, length);
+	Map<DenseVector<Scalar>> result(vout, length);
+	result = first * scale;
+}
+
+template<typename Scalar>
+static Scalar dense_vnorm(const Scalar* v1, int size)
+{
+	Map<const DenseVector<Scalar>> vector(v1, size);
+	return vector.norm();
+}
+
+template<typename Scalar>
+static Scalar dense_vsquared_norm(const Scalar* v1, int size)
+{
+	Map<const DenseVector<Scalar>> vector(v1, size);
+	return vector.squaredNorm();
+}
+
+template<typename Scalar>
+static void dense_minus(const Scalar* m1, int row1, int col1, const Scalar* m2, int row2, int col2, Scalar* vout)
+{
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	Map<const DenseMatrix<Scalar>> matrix2(m2, row2, col2);
+	Map<DenseMatrix<Scalar>> result(vout, row1, col2);
+	result = matrix1 - matrix2;
+}
+
+template<typename Scalar>
+static void dense_mult(const Scalar* m1, int row1, int col1, const Scalar* m2, int row2, int col2, Scalar* vout)
+{
+	apply_thread_budget();
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	Map<const DenseMatrix<Scalar>> matrix2(m2, row2, col2);
+	Map<DenseMatrix<Scalar>> result(vout, row1, col2);
+	result.noalias() = matrix1 * matrix2;
+}
+
+// C = alpha * op(A) * op(B) + beta * C, op transposes when its flag is set. The product is
+// accumulated straight into C by the GEMM kernel, no temporary, unless C is also A or B; as in
+// BLAS, beta = 0 ignores the previous contents of C.
+template<typename Scalar>
+static void dense_gemm(const Scalar* m1, int row1, int col1, bool transpose1, const Scalar* m2, int row2, int col2, bool transpose2,
+	Scalar alpha, Scalar beta, Scalar* vout)
+{
+	apply_thread_budget();
+	const int rows = transpose1 ? col1 : row1;
+	const int cols = transpose2 ? row2 : col2;
+	DenseMatrix<Scalar> saved;
+	if (vout == m1 || vout == m2) {
+		saved = Map<const DenseMatrix<Scalar>>(vout, rows, cols);
+		m1 = vout == m1 ? saved.data() : m1;
+		m2 = vout == m2 ? saved.data() : m2;
+	}
+
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	Map<const DenseMatrix<Scalar>> matrix2(m2, row2, col2);
+	Map<DenseMatrix<Scalar>> result(vout, rows, cols);
+	if (beta == Scalar(0))
+		result.setZero();
+	else if (beta != Scalar(1))
+		result *= beta;
+
+	if (alpha == Scalar(0))
+		return;
+
+	if (transpose1 && transpose2)
+		result.noalias() += alpha * matrix1.transpose() * matrix2.transpose();
+	else if (transpose1)
+		result.noalias() += alpha * matrix1.transpose() * matrix2;
+	else if (transpose2)
+		result.noalias() += alpha * matrix1 * matrix2.transpose();
+	else
+		result.noalias() += alpha * matrix1 * matrix2;
+}
+
+template<typename Scalar>
+static void dense_multv(const Scalar* m1, int row1, int col1, const Scalar* v1, int length, Scalar* vout)
+{
+	Map<const DenseMatrix<Scalar>> matrix(m1, row1, col1);
+	Map<const DenseVector<Scalar>> vector(v1, length);
+	Map<DenseVector<Scalar>> result(vout, row1);
+	result.noalias() = matrix * vector;
+}
+
+template<typename Scalar>
+static void dense_transp(const Scalar* m1, int row1, int col1, Scalar* vout)
+{
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	Map<DenseMatrix<Scalar>> result(vout, col1, row1);
+	result = matrix1.transpose();
+}
+
+template<typename Scalar>
+static Scalar dense_trace(const Scalar* m1, int row1, int col1)
+{
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	return matrix1.trace();
+}
+
+template<typename Scalar>
+static Scalar dense_norm(const Scalar* m1, int row1, int col1)
+{
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row1, col1);
+	return matrix1.norm();
+}
+
+template<typename Scalar>
+static Scalar dense_determinant(const Scalar* m1, int row, int col)
+{
+	apply_thread_budget();
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row, col);
+	return matrix1.determinant();
+}
+
+template<typename Scalar>
+static void dense_inverse(const Scalar* m1, int row, int col, Scalar* vout)
+{
+	apply_thread_budget();
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row, col);
+	Map<DenseMatrix<Scalar>> result(vout, row, row);
+	result = matrix1.inverse();
+}
+
+// A x = b with the given decomposition of A.
+template<typename Decomposition, typename Scalar>
+static void dense_solve(const Scalar* m1, int row, int col, const Scalar* v1, Scalar* vout)
+{
+	apply_thread_budget();
+	Map<const DenseMatrix<Scalar>> matrix1(m1, row, col);
+	Map<const DenseVector<Scalar>> rhs(v1, row);
+	Map<DenseVector<Scalar>> result(vout, row);
+	result = Decomposition(matrix1).solve(rhs);
+}
+
 // dot product between two vectors.
 EXPORT_API(double) ddot_(_In_  double* v1, _In_  double* v2, int length1)
 {
-	Map<const VectorXd> first(v1, length1);
-	Map<const VectorXd> second(v2, length1);
-	return first.dot(second);
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	return dense_dot(v1, v2, length1);
 }
 
 // addition of two vectors.
 EXPORT_API(void) dadd_(_In_ double* v1, _In_ double* v2, int length1, _Out_ double* vout)
 {
-	Map<const VectorXd> first(v1, length1);
-	Map<const VectorXd> second(v2, length1);
-	Map<VectorXd>  result(vout, length1);
-	result = first + second;
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	dense_add(v1, v2, length1, vout);
 }
 
 
 // scale a vector by a scalar.
 EXPORT_API(void) dscale_(_In_ double* v1, double scale, int length1, _Out_ double* vout)
 {
-	Map<const VectorXd> first(v1, length1);
-	Map<VectorXd> result(vout, length1);
-	result = first * scale;
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	dense_scale(v1, scale, length1, vout);
 }
 
 EXPORT_API(double) dvnorm_(_In_ double* v1, const int size)
 {
-	Map<const VectorXd> vector(v1, size);
-	return vector.norm();
+	INSTRUMENT_EXPORT(size, 1, 0);
+	return dense_vnorm(v1, size);
 }
 
 EXPORT_API(double) dvsquared_norm_(_In_ double* v1, const int size)
 {
-	Map<const VectorXd> vector(v1, size);
-	return vector.squaredNorm();
+	INSTRUMENT_EXPORT(size, 1, 0);
+	return dense_vsquared_norm(v1, size);
 }
 
 EXPORT_API(double) dvlp1_norm_(_In_ double* v1, const int size)
 {
+	INSTRUMENT_EXPORT(size, 1, 0);
 	Map<const VectorXd> vector(v1, size);
 	return vector.lpNorm<1>();
 }
 
 EXPORT_API(double) dvlpinf_norm_(_In_ double* v1, const int size)
 {
+	INSTRUMENT_EXPORT(size, 1, 0);
 	Map<const VectorXd> vector(v1, size);
 	return vector.lpNorm<Infinity>();
 }
 
+// in-place BLAS-1 kernels, the vector written is the last argument and the caller's own storage.
+// y += alpha * x.
+EXPORT_API(void) dvaxpy_(const double alpha, _In_ double* v1, const int length, _Inout_ double* vout)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	Map<const VectorXd> x(v1, length);
+	Map<VectorXd> y(vout, length);
+	y.noalias() += alpha * x;
+}
+
+// y = alpha * x + beta * y.
+EXPORT_API(void) dvaxpby_(const double alpha, _In_ double* v1, const double beta, const int length, _Inout_ double* vout)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	Map<const VectorXd> x(v1, length);
+	Map<VectorXd> y(vout, length);
+	y = alpha * x + beta * y;
+}
+
+// x *= alpha.
+EXPORT_API(void) dvscal_(const double alpha, const int length, _Inout_ double* vout)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	Map<VectorXd>(vout, length) *= alpha;
+}
+
+// y = x.
+EXPORT_API(void) dvcopy_(_In_ double* v1, const int length, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	Map<VectorXd>(vout, length) = Map<const VectorXd>(v1, length);
+}
+
+// the fused kernels walk the vectors in blocks small enough to stay in L1, so the second
+// reduction or update of a block rereads it from cache and memory is traversed once.
+static const int FusedBlock = 512;
+
+// returns x . y and writes x . x.
+EXPORT_API(double) dvdot_squared_norm_(_In_ double* v1, _In_ double* v2, const int length, _Out_ double* squaredNorm)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	double dot = 0;
+	double norm = 0;
+	for (int start = 0; start < length; start += FusedBlock) {
+		const int size = MIN(FusedBlock, length - start);
+		Map<const VectorXd> x(v1 + start, size);
+		Map<const VectorXd> y(v2 + start, size);
+		dot += x.dot(y);
+		norm += x.squaredNorm();
+	}
+
+	*squaredNorm = norm;
+	return dot;
+}
+
+// the conjugate gradient update x += alpha * p, r -= alpha * q (q = A p), returns r . r.
+EXPORT_API(double) dvcg_update_(const double alpha, _In_ double* p, _In_ double* q, const int length, _Inout_ double* x, _Inout_ double* r)
+{
+	INSTRUMENT_EXPORT(length, 1, 0);
+	double norm = 0;
+	for (int start = 0; start < length; start += FusedBlock) {
+		const int size = MIN(FusedBlock, length - start);
+		Map<VectorXd> residual(r + start, size);
+		Map<VectorXd>(x + start, size).noalias() += alpha * Map<const VectorXd>(p + start, size);
+		residual.noalias() -= alpha * Map<const VectorXd>(q + start, size);
+		norm += residual.squaredNorm();
+	}
+
+	return norm;
+}
+
 // m1 - m2.
 EXPORT_API(void) dminus_(_In_ double* m1, const int row1, const int col1, _In_ double* m2, const int row2, const int col2, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row1, col1);
-	Map<const MatrixXd> matrix2(m2, row2, col2);
-	Map<MatrixXd> result(vout, row1, col2);
-	result = matrix1 - matrix2;
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_minus(m1, row1, col1, m2, row2, col2, vout);
 }
 
 // matrix product of m1 and m2.
 EXPORT_API(void) dmult_(_In_ double* m1, const int row1, const int col1, _In_ double* m2, const int row2, const int col2, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row1, col1);
-	Map<const MatrixXd> matrix2(m2, row2, col2);
-	Map<MatrixXd> result(vout, row1, col2);
-	result = matrix1 * matrix2;
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_mult(m1, row1, col1, m2, row2, col2, vout);
+}
+
+// C = alpha * op(A) * op(B) + beta * C in place, C is rows(op(A)) x cols(op(B)).
+EXPORT_API(void) dgemm_(
+	_In_ double* m1,
+	const int row1,
+	const int col1,
+	const int transpose1,
+	_In_ double* m2,
+	const int row2,
+	const int col2,
+	const int transpose2,
+	const double alpha,
+	const double beta,
+	_Inout_ double* vout)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_gemm(m1, row1, col1, transpose1 != 0, m2, row2, col2, transpose2 != 0, alpha, beta, vout);
 }
 
 // matrix product of m1 and v1.
 EXPORT_API(void) dmultv_(_In_ double* m1, const int row1, const int col1, _In_ double* v1, const int length, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix(m1, row1, col1);
-	Map<const VectorXd> vector(v1, length);
-	Map<VectorXd> result(vout, row1);
-	result = matrix * vector;
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_multv(m1, row1, col1, v1, length, vout);
 }
 
 // matrix transpose.
 EXPORT_API(void) dtransp_(_In_ double* m1, const int row1, const int col1, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row1, col1);
-	Map<MatrixXd> result(vout, col1, row1);
-	result = matrix1.transpose();
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_transp(m1, row1, col1, vout);
 }
 
 //  A * B^T
 EXPORT_API(void) dmultt_(_In_ double* v1, const int row1, const int col1, _In_ double* v2, const int row2, const int col2, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(v1, row1, col1);
 	Map<const MatrixXd> matrix2(v2, row2, col2);
 	Map<MatrixXd> result(vout, row1, row2);
-	result = matrix1 * matrix2.transpose();
+	result.noalias() = matrix1 * matrix2.transpose();
 }
 
 //  A * A^T 
 EXPORT_API(void) da_multt_(_In_ double* m1, const int row1, const int col1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row1, col1);
 	Map<MatrixXd> result(vout, row1, row1);
-	result =  matrix1 * matrix1.transpose();
+	result.noalias() = matrix1 * matrix1.transpose();
 }
 
 //  A^T * A
 EXPORT_API(void) da_tmult_(_In_ double* m1, const int row1, const int col1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row1, col1);
 	Map<MatrixXd> result(vout, col1, col1);
-	result = matrix1.transpose() * matrix1;
+	result.noalias() = matrix1.transpose() * matrix1;
 }
 
 // matrix trace.
 EXPORT_API(double) dtrace_(_In_ double* m1, const int row1, const int col1)
 {
-	Map<const MatrixXd> matrix1(m1, row1, col1);
-	return matrix1.trace();
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	return dense_trace(m1, row1, col1);
 }
 
 EXPORT_API(double) dnorm_(_In_ double* m1, const int row1, const int col1)
 {
-	Map<const MatrixXd> matrix1(m1, row1, col1);
-	return matrix1.norm();
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	return dense_norm(m1, row1, col1);
 }
 
 EXPORT_API(double) dsquared_norm_(_In_ double* m1, const int row1, const int col1)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
 	Map<const MatrixXd> matrix1(m1, row1, col1);
 	return matrix1.squaredNorm();
 }
 
 EXPORT_API(double) dlp1_norm_(_In_ double* m1, const int row1, const int col1)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
 	Map<const MatrixXd> matrix1(m1, row1, col1);
 	return matrix1.lpNorm<1>();
 }
 
 EXPORT_API(double) dlpinf_norm_(_In_ double* m1, const int row1, const int col1)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
 	Map<const MatrixXd> matrix1(m1, row1, col1);
 	return matrix1.lpNorm<Infinity>();
 }
@@ -158,6 +873,8 @@ EXPORT_API(void) deigenvalues_(_In_ double* m1,
 	_Out_ double* out_real_eigenvectors,
 	_Out_ double* out_image_eigenvectors)
 {
+	INSTRUMENT_EXPORT(size, size, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix(m1, size, size);
 	EigenSolver<MatrixXd> esolver(matrix);
 	VectorXcd  eigenvalues = esolver.eigenvalues();
@@ -176,6 +893,8 @@ EXPORT_API(void) deigenvalues_(_In_ double* m1,
 // matrix eigenvalues for self symetric matrix.
 EXPORT_API(void) dselfadjoint_eigenvalues_(_In_ double* m1, const int size, _Out_ double* out_real_eigen, _Out_ double* out_real_eigenvectors)
 {
+	INSTRUMENT_EXPORT(size, size, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix(m1, size, size);
 	SelfAdjointEigenSolver<MatrixXd> esolver(matrix);
 	VectorXcd  eigenvalues = esolver.eigenvalues();
@@ -190,6 +909,7 @@ EXPORT_API(void) dselfadjoint_eigenvalues_(_In_ double* m1, const int size, _Out
 // A = X + X^T
 EXPORT_API(void) dxplusxt_(_In_ double* m1, int size, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(size, size, 0);
 	Map<const MatrixXd> matrix(m1, size, size);
 	Map<MatrixXd> result(vout, size, size);
 	result = matrix + matrix.transpose();
@@ -198,6 +918,7 @@ EXPORT_API(void) dxplusxt_(_In_ double* m1, int size, _Out_ double* vout)
 // A = X + Y
 EXPORT_API(void) dxplusa_(_In_ double* v1, const int row1, const int col1, _In_ double* v2, const int row2, const int col2, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row1, col1, 0);
 	Map<const MatrixXd> matrix1(v1, row1, col1);
 	Map<const MatrixXd> matrix2(v2, row2, col2);
 	Map<MatrixXd> result(vout, row1, col1);
@@ -207,6 +928,8 @@ EXPORT_API(void) dxplusa_(_In_ double* v1, const int row1, const int col1, _In_
 // svd
 EXPORT_API(void) dsvd_(_In_ double* m1, const int row, const int col, _Out_ double* uout, _Out_ double* sout, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	int minRowsCols = MIN(row, col);
 	Map<const MatrixXd> matrix1(m1, row, col);
 	JacobiSVD<MatrixXd> svd(matrix1, ComputeThinU | ComputeThinV);
@@ -220,6 +943,8 @@ EXPORT_API(void) dsvd_(_In_ double* m1, const int row, const int col, _Out_ doub
 
 EXPORT_API(void) dsvd_leastsquares_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	int minRowsCols = MIN(row, col);
 	Map<const MatrixXd> matrix1(m1, row, col);
 	JacobiSVD<MatrixXd> svd(matrix1, ComputeThinU | ComputeThinV);
@@ -230,9 +955,11 @@ EXPORT_API(void) dsvd_leastsquares_(_In_ double* m1, const int row, const int co
 
 EXPORT_API(void) dsvd_bdcSvd_(_In_ double* m1, const int row, const int col, _Out_ double* uout, _Out_ double* sout, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	int minRowsCols = MIN(row, col);
 	Map<const MatrixXd> matrix1(m1, row, col);
-	JacobiSVD<MatrixXd> bdcSvd(matrix1, ComputeThinU | ComputeThinV);
+	BDCSVD<MatrixXd> bdcSvd(matrix1, ComputeThinU | ComputeThinV);
 	Map<MatrixXd> u(uout, row, minRowsCols);
 	Map<VectorXd> s(sout, minRowsCols);
 	Map<MatrixXd> v(vout, col, minRowsCols);
@@ -243,18 +970,91 @@ EXPORT_API(void) dsvd_bdcSvd_(_In_ double* m1, const int row, const int col, _Ou
 
 EXPORT_API(void) dsvd_bdcSvd__leastsquares_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	int minRowsCols = MIN(row, col);
 	Map<const MatrixXd> matrix1(m1, row, col);
-	JacobiSVD<MatrixXd> bdcSvd(matrix1, ComputeThinU | ComputeThinV);
+	BDCSVD<MatrixXd> bdcSvd(matrix1, ComputeThinU | ComputeThinV);
 	Map<VectorXd> rhs(v1, row);
 	Map<VectorXd> result(vout, minRowsCols);
 	result = bdcSvd.solve(rhs);
 }
 
+// uniform in [-1, 1) from a splitmix64 stream, deterministic and independent of the global rand state.
+static double splitmix_uniform(uint64_t& state)
+{
+	uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	z ^= z >> 31;
+	return static_cast<double>(z >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+// orthonormal basis of the columns of Y, in place, from a Householder QR.
+static void orthonormalize_columns(MatrixXd& Y)
+{
+	HouseholderQR<MatrixXd> qr(Y);
+	Y.setIdentity();
+	Y.applyOnTheLeft(qr.householderQ());
+}
+
+// randomized truncated SVD (Halko, Martinsson and Tropp): Y = A * Omega with rank + oversampling
+// random columns, powerIterations rounds of Q = orth(A * orth(A^T * Q)) to sharpen a slowly
+// decaying spectrum, then the small SVD of B = Q^T * A. Every step is a GEMM or a thin QR, so the
+// cost is O(row * col * (rank + oversampling)) and runs on the thread budget.
+EXPORT_API(int) dsvd_randomized_(
+	_In_ double* m1,
+	const int row,
+	const int col,
+	const int rank,
+	const int oversampling,
+	const int powerIterations,
+	_Out_ double* uout,
+	_Out_ double* sout,
+	_Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
+	const int minRowsCols = MIN(row, col);
+	if (rank < 1 || rank > minRowsCols || oversampling < 0 || powerIterations < 0)
+		return InvalidInput;
+
+	const int samples = MIN(rank + oversampling, minRowsCols);
+	Map<const MatrixXd> matrix1(m1, row, col);
+	MatrixXd omega(col, samples);
+	uint64_t state = 0x5EED5EEDull;
+	for (Index j = 0; j < omega.cols(); ++j)
+		for (Index i = 0; i < omega.rows(); ++i)
+			omega(i, j) = splitmix_uniform(state);
+
+	MatrixXd Q(row, samples);
+	Q.noalias() = matrix1 * omega;
+	orthonormalize_columns(Q);
+	MatrixXd Z(col, samples);
+	for (int i = 0; i < powerIterations; ++i) {
+		Z.noalias() = matrix1.transpose() * Q;
+		orthonormalize_columns(Z);
+		Q.noalias() = matrix1 * Z;
+		orthonormalize_columns(Q);
+	}
+
+	MatrixXd B(samples, col);
+	B.noalias() = Q.transpose() * matrix1;
+	BDCSVD<MatrixXd> svd(B, ComputeThinU | ComputeThinV);
+	Map<MatrixXd> u(uout, row, rank);
+	Map<VectorXd> s(sout, rank);
+	Map<MatrixXd> v(vout, col, rank);
+	u.noalias() = Q * svd.matrixU().leftCols(rank);
+	s = svd.singularValues().head(rank);
+	v = svd.matrixV().leftCols(rank);
+	return Success;
+}
+
 EXPORT_API(void) dnormal_equations__leastsquares_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row, col);
-	JacobiSVD<MatrixXd> bdcSvd(matrix1, ComputeThinU | ComputeThinV);
 	Map<VectorXd> rhs(v1, row);
 	Map<VectorXd> result(vout, col);
 	result = (matrix1.transpose() * matrix1).ldlt().solve(matrix1.transpose() * rhs);
@@ -263,22 +1063,20 @@ EXPORT_API(void) dnormal_equations__leastsquares_(_In_ double* m1, const int row
 // Householder rank-revealing QR decomposition of a matrix with column-pivoting.
 EXPORT_API(void) dsolve_colPivHouseholderQr_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> result(vout, row);
-	result = matrix1.colPivHouseholderQr().solve(rhs);
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<ColPivHouseholderQR<MatrixXd>>(m1, row, col, v1, vout);
 }
 
 EXPORT_API(void) dsolve_partialPivLU_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> result(vout, row);
-	result = matrix1.partialPivLu().solve(rhs);
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<PartialPivLU<MatrixXd>>(m1, row, col, v1, vout);
 }
 
 EXPORT_API(void) dsolve_fullPivLu_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<VectorXd> rhs(v1, row);
 	Map<VectorXd> result(vout, row);
@@ -288,35 +1086,31 @@ EXPORT_API(void) dsolve_fullPivLu_(_In_ double* m1, const int row, const int col
 // Standard Cholesky decomposition (LL^T) of a matrix and associated features.
 EXPORT_API(void) dsolve_llt_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> result(vout, row);
-	result = matrix1.llt().solve(rhs);
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<LLT<MatrixXd>>(m1, row, col, v1, vout);
 }
 
 // Perform a robust Cholesky decomposition of a positive semidefinite or negative semidefinite matrix.
 EXPORT_API(void) dsolve_ldlt_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> result(vout, row);
-	result = matrix1.ldlt().solve(rhs);
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<LDLT<MatrixXd>>(m1, row, col, v1, vout);
 }
 
 EXPORT_API(double) ddeterminant_(_In_ double* m1, const int row, const int col)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	return matrix1.determinant();
+	INSTRUMENT_EXPORT(row, col, 0);
+	return dense_determinant(m1, row, col);
 }
 
 EXPORT_API(void) dinverse_(_In_ double* m1, const int row, const int col, _Out_ double* vout)
 {
-	Map<const MatrixXd> matrix1(m1, row, col);
-	Map<MatrixXd> result(vout, row, row);
-	result = matrix1.inverse();
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_inverse(m1, row, col, vout);
 }
 
 EXPORT_API(double) drelative_error_(_In_ double* m1, const int row, const int col, _In_ double* v1, _In_ double* v2) {
+	INSTRUMENT_EXPORT(row, col, 0);
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<VectorXd> rhs(v1, row);
 	Map<VectorXd> x(v2, row);
@@ -324,6 +1118,7 @@ EXPORT_API(double) drelative_error_(_In_ double* m1, const int row, const int co
 }
 
 EXPORT_API(double) dabsolute_error_(_In_ double* m1, const int row, const int col, _In_ double* v1, _In_ double* v2) {
+	INSTRUMENT_EXPORT(row, col, 0);
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<VectorXd> rhs(v1, row);
 	Map<VectorXd> x(v2, row);
@@ -331,6 +1126,8 @@ EXPORT_API(double) dabsolute_error_(_In_ double* m1, const int row, const int co
 }
 
 EXPORT_API(void) dhouseholderQR_(_In_ double* m1, const int row, const int col, _Out_ double* v1, _Out_ double* v2) {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<MatrixXd> Q(v1, row, row);
 	Map<MatrixXd> R(v2, row, col);
@@ -340,6 +1137,8 @@ EXPORT_API(void) dhouseholderQR_(_In_ double* m1, const int row, const int col,
 }
 
 EXPORT_API(void) dcolPivHouseholderQR_(_In_ double* m1, const int row, const int col, _Out_ double* v1, _Out_ double* v2, _Out_ double *v3) {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<MatrixXd> Q(v1, row, row);
 	Map<MatrixXd> R(v2, row, col);
@@ -357,6 +1156,8 @@ EXPORT_API(void) dfullPivLU_(_In_ double* m1,
 	_Out_ double* v2,
 	_Out_ double* v3,
 	_Out_ double* v4) {
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
 	Map<const MatrixXd> matrix1(m1, row, col);
 	Map<MatrixXd>  L(v1, row, row);
 	Map<MatrixXd>  U(v2, row, col);
@@ -372,509 +1173,4459 @@ EXPORT_API(void) dfullPivLU_(_In_ double* m1,
 	L = lu.matrixLU().triangularView<StrictlyLower>();
 }
 
-EXPORT_API(bool) ssolve_conjugateGradient_(
-	int row,
-	int col,
-	int nnz,
-	int maxIterations,
-	double tolerance,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
+// Complete orthogonal decomposition, the minimum norm solution for rank deficient matrices.
+EXPORT_API(void) dsolve_completeOrthogonalDecomposition_(_In_ double* m1, const int row, const int col, _In_ double* v1, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
+	Map<const MatrixXd> matrix1(m1, row, col);
+	Map<VectorXd> rhs(v1, row);
+	Map<VectorXd> result(vout, col);
+	result = matrix1.completeOrthogonalDecomposition().solve(rhs);
+}
+
+// success of a dense decomposition.
+template<typename MatrixType>
+static bool decomposition_ok(const PartialPivLU<MatrixType>& dec)
+{
+	return dec.matrixLU().diagonal().cwiseAbs().minCoeff() > 0;
+}
+
+template<typename MatrixType>
+static bool decomposition_ok(const LLT<MatrixType>& dec)
+{
+	return dec.info() == Success;
+}
+
+template<typename MatrixType>
+static bool decomposition_ok(const LDLT<MatrixType>& dec)
+{
+	return dec.info() == Success;
+}
+
+template<typename Decomposition>
+static bool decomposition_ok(const Decomposition& dec)
+{
+	return dec.isInvertible();
+}
+
+// determinant of the orthogonal factor Q = H_0 ... H_k-1, each non trivial reflector flips the sign.
+template<typename Decomposition>
+static double householder_sign(const Decomposition& dec)
+{
+	Index reflections = (dec.hCoeffs().array() != 0.0).count();
+	return (reflections % 2 == 0) ? 1.0 : -1.0;
+}
+
+// determinant from the stored factors.
+template<typename Decomposition>
+static double decomposition_determinant(const Decomposition& dec)
+{
+	return dec.determinant();
+}
+
+static double decomposition_determinant(const LLT<MatrixXd>& dec)
+{
+	double diagonalProduct = dec.matrixLLT().diagonal().prod();
+	return diagonalProduct * diagonalProduct;
+}
+
+static double decomposition_determinant(const LDLT<MatrixXd>& dec)
+{
+	return dec.vectorD().prod();
+}
+
+static double decomposition_determinant(const ColPivHouseholderQR<MatrixXd>& dec)
+{
+	return householder_sign(dec) * dec.matrixR().diagonal().prod() * dec.colsPermutation().determinant();
+}
+
+static double decomposition_determinant(const CompleteOrthogonalDecomposition<MatrixXd>& dec)
+{
+	if (dec.rank() < dec.cols())
+	{
+		return 0.0;
+	}
+
+	return householder_sign(dec) * dec.matrixT().diagonal().prod() * dec.colsPermutation().determinant();
+}
+
+// logarithm of the absolute value of the determinant, does not overflow for large matrices.
+template<typename Decomposition>
+static double decomposition_logAbsDeterminant(const Decomposition& dec)
+{
+	return dec.matrixLU().diagonal().cwiseAbs().array().log().sum();
+}
+
+static double decomposition_logAbsDeterminant(const LLT<MatrixXd>& dec)
+{
+	return 2.0 * dec.matrixLLT().diagonal().array().log().sum();
+}
+
+static double decomposition_logAbsDeterminant(const LDLT<MatrixXd>& dec)
+{
+	return dec.vectorD().cwiseAbs().array().log().sum();
+}
+
+static double decomposition_logAbsDeterminant(const ColPivHouseholderQR<MatrixXd>& dec)
+{
+	return dec.logAbsDeterminant();
+}
+
+static double decomposition_logAbsDeterminant(const CompleteOrthogonalDecomposition<MatrixXd>& dec)
+{
+	if (dec.rank() < dec.cols())
+	{
+		return -numeric_limits<double>::infinity();
+	}
+
+	return dec.matrixT().diagonal().cwiseAbs().array().log().sum();
+}
+
+// A^T x = b from the stored factors.
+template<typename Decomposition>
+static void decomposition_solveTranspose(const Decomposition& dec, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	x = dec.transpose().solve(rhs);
+}
+
+// self adjoint decompositions.
+static void decomposition_solveTranspose(const LLT<MatrixXd>& dec, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	x = dec.solve(rhs);
+}
+
+static void decomposition_solveTranspose(const LDLT<MatrixXd>& dec, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	x = dec.solve(rhs);
+}
+
+// A P = Q R  =>  A^T = P R^T Q^T, the basic solution is x = Q [R11^-T (P^T b)_r; 0].
+template<typename Decomposition, typename RMatrix>
+static void qr_solveTranspose(const Decomposition& dec, const RMatrix& R, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	const Index rank = dec.rank();
+	MatrixXd c = dec.colsPermutation().transpose() * rhs;
+	MatrixXd y = MatrixXd::Zero(dec.rows(), rhs.cols());
+	y.topRows(rank) = R.topLeftCorner(rank, rank).template triangularView<Upper>().transpose().solve(c.topRows(rank));
+	x = dec.householderQ() * y;
+}
+
+static void decomposition_solveTranspose(const ColPivHouseholderQR<MatrixXd>& dec, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	qr_solveTranspose(dec, dec.matrixR(), rhs, x);
+}
+
+// for full column rank Z is the identity and T is the R factor of the pivoted QR,
+// otherwise A^+^T b is the minimum norm solution.
+static void decomposition_solveTranspose(const CompleteOrthogonalDecomposition<MatrixXd>& dec, const Map<const MatrixXd>& rhs, Map<MatrixXd>& x)
+{
+	if (dec.rank() == dec.cols())
+	{
+		qr_solveTranspose(dec, dec.matrixT(), rhs, x);
+	}
+	else
+	{
+		MatrixXd pseudoInverse = dec.pseudoInverse();
+		x = pseudoInverse.transpose() * rhs;
+	}
+}
+
+// Dense decomposition kept alive between calls, a matrix factorized once
+// serves many O(n^2) solves.
+class DenseFactorization
+{
+public:
+	virtual ~DenseFactorization() {}
+	virtual bool compute(const Map<const MatrixXd>& matrix) = 0;
+	virtual void solve(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) const = 0;
+	virtual void solveTranspose(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) const = 0;
+	virtual double determinant() const = 0;
+	virtual double logAbsDeterminant() const = 0;
+	Index rows() const { return m_rows; }
+	Index cols() const { return m_cols; }
+
+protected:
+	Index m_rows = 0;
+	Index m_cols = 0;
+};
+
+template<typename Decomposition>
+class DenseFactorizationImpl : public DenseFactorization
+{
+public:
+	bool compute(const Map<const MatrixXd>& matrix) override
+	{
+		m_rows = matrix.rows();
+		m_cols = matrix.cols();
+		dec.compute(matrix);
+		return decomposition_ok(dec);
+	}
+
+	void solve(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) const override
+	{
+		x = dec.solve(rhs);
+	}
+
+	void solveTranspose(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) const override
+	{
+		decomposition_solveTranspose(dec, rhs, x);
+	}
+
+	double determinant() const override
+	{
+		return decomposition_determinant(dec);
+	}
+
+	double logAbsDeterminant() const override
+	{
+		return decomposition_logAbsDeterminant(dec);
+	}
+
+private:
+	Decomposition dec;
+};
+
+// must match EigenCore.Core.Dense.LinearAlgebra.DenseSolverType.
+enum DenseSolverType
+{
+	ColPivHouseholderQRSolver = 0,
+	LLTSolver = 1,
+	LDLTSolver = 2,
+	PartialPivLUSolver = 3,
+	FullPivLUSolver = 4,
+	CompleteOrthogonalDecompositionSolver = 5,
+	MixedPrecisionPartialPivLUSolver = 6,
+	MixedPrecisionLLTSolver = 7
+};
+
+EXPORT_API(void*) dfactorization_create_(int solverType)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	// kept factorizations are double, mixed precision types use their double counterpart.
+	switch (solverType)
+	{
+	case LLTSolver:
+	case MixedPrecisionLLTSolver:
+		return new DenseFactorizationImpl<LLT<MatrixXd>>();
+	case LDLTSolver:
+		return new DenseFactorizationImpl<LDLT<MatrixXd>>();
+	case PartialPivLUSolver:
+	case MixedPrecisionPartialPivLUSolver:
+		return new DenseFactorizationImpl<PartialPivLU<MatrixXd>>();
+	case FullPivLUSolver:
+		return new DenseFactorizationImpl<FullPivLU<MatrixXd>>();
+	case CompleteOrthogonalDecompositionSolver:
+		return new DenseFactorizationImpl<CompleteOrthogonalDecomposition<MatrixXd>>();
+	case ColPivHouseholderQRSolver:
+	default:
+		return new DenseFactorizationImpl<ColPivHouseholderQR<MatrixXd>>();
+	}
+}
+
+EXPORT_API(bool) dfactorization_compute_(_In_ void* handle, _In_ double* m1, const int row, const int col)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
+	Map<const MatrixXd> matrix1(m1, row, col);
+	return static_cast<DenseFactorization*>(handle)->compute(matrix1);
+}
+
+// A x = b.
+EXPORT_API(void) dfactorization_solve_(_In_ void* handle, _In_ double* v1, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	apply_thread_budget();
+	DenseFactorization* factorization = static_cast<DenseFactorization*>(handle);
+	Map<const MatrixXd> rhs(v1, factorization->rows(), 1);
+	Map<MatrixXd> result(vout, factorization->cols(), 1);
+	factorization->solve(rhs, result);
+}
+
+// A^T x = b.
+EXPORT_API(void) dfactorization_solveTranspose_(_In_ void* handle, _In_ double* v1, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	apply_thread_budget();
+	DenseFactorization* factorization = static_cast<DenseFactorization*>(handle);
+	Map<const MatrixXd> rhs(v1, factorization->cols(), 1);
+	Map<MatrixXd> result(vout, factorization->rows(), 1);
+	factorization->solveTranspose(rhs, result);
+}
+
+EXPORT_API(double) dfactorization_determinant_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	return static_cast<DenseFactorization*>(handle)->determinant();
+}
+
+EXPORT_API(double) dfactorization_logAbsDeterminant_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	return static_cast<DenseFactorization*>(handle)->logAbsDeterminant();
+}
+
+EXPORT_API(void) dfactorization_destroy_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<DenseFactorization*>(handle);
+}
+
+// A X = B for a column-major row x rhsCols block of right-hand sides, the
+// matrix is factorized once and all columns go through the blocked solves.
+EXPORT_API(void) dsolve_block_(
+	int solverType,
+	_In_ double* m1,
+	const int row,
+	const int col,
+	_In_ double* b,
+	const int rhsCols,
+	_Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
+	Map<const MatrixXd> matrix1(m1, row, col);
+	Map<const MatrixXd> rhs(b, row, rhsCols);
+	Map<MatrixXd> result(vout, col, rhsCols);
+	unique_ptr<DenseFactorization> factorization(static_cast<DenseFactorization*>(dfactorization_create_(solverType)));
+	factorization->compute(matrix1);
+	factorization->solve(rhs, result);
+}
+
+// A X = B.
+EXPORT_API(void) dfactorization_solveBlock_(_In_ void* handle, _In_ double* b, const int rhsCols, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	apply_thread_budget();
+	DenseFactorization* factorization = static_cast<DenseFactorization*>(handle);
+	Map<const MatrixXd> rhs(b, factorization->rows(), rhsCols);
+	Map<MatrixXd> result(vout, factorization->cols(), rhsCols);
+	factorization->solve(rhs, result);
+}
+
+// A^T X = B.
+EXPORT_API(void) dfactorization_solveTransposeBlock_(_In_ void* handle, _In_ double* b, const int rhsCols, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(static_cast<DenseFactorization*>(handle)->rows(), static_cast<DenseFactorization*>(handle)->cols(), 0);
+	apply_thread_budget();
+	DenseFactorization* factorization = static_cast<DenseFactorization*>(handle);
+	Map<const MatrixXd> rhs(b, factorization->cols(), rhsCols);
+	Map<MatrixXd> result(vout, factorization->rows(), rhsCols);
+	factorization->solveTranspose(rhs, result);
+}
+
+// Iterative refinement with a single precision factorization `low` of A: the residual
+// r = b - A x is formed in double, the correction A d = r is solved with the float
+// factors and x += d. Converged once |r| <= |x| |A| sqrt(n) eps (infinity norms, eps of
+// double); false when a step fails to halve |r| or max_refinement_steps is reached.
+static const int max_refinement_steps = 30;
+
+template<typename LowDecomposition, typename MatrixType>
+static bool iterative_refinement(const LowDecomposition& low, const MatrixType& matrix, double matrixNorm,
+	const Map<const VectorXd>& rhs, Map<VectorXd>& x, int* steps)
+{
+	const double tolerance = matrixNorm * sqrt((double)matrix.cols()) * NumTraits<double>::epsilon();
+
+	x = low.solve(rhs.cast<float>()).template cast<double>();
+	VectorXd residual = rhs - matrix * x;
+	double residualNorm = residual.lpNorm<Infinity>();
+
+	for (*steps = 0; residualNorm > x.lpNorm<Infinity>() * tolerance || !isfinite(residualNorm); ++*steps) {
+		if (*steps == max_refinement_steps) {
+			return false;
+		}
+
+		x += low.solve(residual.cast<float>()).template cast<double>();
+		residual = rhs - matrix * x;
+
+		double previousNorm = residualNorm;
+		residualNorm = residual.lpNorm<Infinity>();
+		if (!(residualNorm <= 0.5 * previousNorm)) {
+			++*steps;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// A x = b factorized in float and refined in double, see iterative_refinement. Falls back
+// to the double factorization when refinement stalls; returns false in that case.
+EXPORT_API(bool) dsolve_mixedPrecision_(
+	int solverType,
+	_In_ double* m1,
+	const int row,
+	const int col,
+	_In_ double* v1,
+	_Out_ double* vout,
+	_Out_ int* steps)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	apply_thread_budget();
+	*steps = 0;
+	Map<const MatrixXd> matrix1(m1, row, col);
+	Map<const VectorXd> rhs(v1, row);
+	Map<VectorXd> result(vout, col);
+	double matrixNorm = matrix1.cwiseAbs().rowwise().sum().maxCoeff();
+
+	if (solverType == LLTSolver || solverType == MixedPrecisionLLTSolver) {
+		LLT<MatrixXf> low(matrix1.cast<float>());
+		if (!decomposition_ok(low) || !iterative_refinement(low, matrix1, matrixNorm, rhs, result, steps)) {
+			result = matrix1.llt().solve(rhs);
+			return false;
+		}
+	}
+	else {
+		PartialPivLU<MatrixXf> low(matrix1.cast<float>());
+		if (!decomposition_ok(low) || !iterative_refinement(low, matrix1, matrixNorm, rhs, result, steps)) {
+			result = matrix1.partialPivLu().solve(rhs);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// single precision dense exports, same layouts as the d* exports.
+EXPORT_API(float) fdot_(_In_ float* v1, _In_ float* v2, int length1)
+{
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	return dense_dot(v1, v2, length1);
+}
+
+EXPORT_API(void) fadd_(_In_ float* v1, _In_ float* v2, int length1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	dense_add(v1, v2, length1, vout);
+}
+
+EXPORT_API(void) fscale_(_In_ float* v1, float scale, int length1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(length1, 1, 0);
+	dense_scale(v1, scale, length1, vout);
+}
+
+EXPORT_API(float) fvnorm_(_In_ float* v1, const int size)
+{
+	INSTRUMENT_EXPORT(size, 1, 0);
+	return dense_vnorm(v1, size);
+}
+
+EXPORT_API(float) fvsquared_norm_(_In_ float* v1, const int size)
+{
+	INSTRUMENT_EXPORT(size, 1, 0);
+	return dense_vsquared_norm(v1, size);
+}
+
+EXPORT_API(void) fminus_(_In_ float* m1, const int row1, const int col1, _In_ float* m2, const int row2, const int col2, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_minus(m1, row1, col1, m2, row2, col2, vout);
+}
+
+EXPORT_API(void) fmult_(_In_ float* m1, const int row1, const int col1, _In_ float* m2, const int row2, const int col2, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_mult(m1, row1, col1, m2, row2, col2, vout);
+}
+
+EXPORT_API(void) fmultv_(_In_ float* m1, const int row1, const int col1, _In_ float* v1, const int length, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_multv(m1, row1, col1, v1, length, vout);
+}
+
+EXPORT_API(void) ftransp_(_In_ float* m1, const int row1, const int col1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	dense_transp(m1, row1, col1, vout);
+}
+
+EXPORT_API(float) ftrace_(_In_ float* m1, const int row1, const int col1)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	return dense_trace(m1, row1, col1);
+}
+
+EXPORT_API(float) fnorm_(_In_ float* m1, const int row1, const int col1)
+{
+	INSTRUMENT_EXPORT(row1, col1, 0);
+	return dense_norm(m1, row1, col1);
+}
+
+EXPORT_API(float) fdeterminant_(_In_ float* m1, const int row, const int col)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	return dense_determinant(m1, row, col);
+}
+
+EXPORT_API(void) finverse_(_In_ float* m1, const int row, const int col, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_inverse(m1, row, col, vout);
+}
+
+EXPORT_API(void) fsolve_colPivHouseholderQr_(_In_ float* m1, const int row, const int col, _In_ float* v1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<ColPivHouseholderQR<MatrixXf>>(m1, row, col, v1, vout);
+}
+
+EXPORT_API(void) fsolve_partialPivLU_(_In_ float* m1, const int row, const int col, _In_ float* v1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<PartialPivLU<MatrixXf>>(m1, row, col, v1, vout);
+}
+
+EXPORT_API(void) fsolve_llt_(_In_ float* m1, const int row, const int col, _In_ float* v1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<LLT<MatrixXf>>(m1, row, col, v1, vout);
+}
+
+EXPORT_API(void) fsolve_ldlt_(_In_ float* m1, const int row, const int col, _In_ float* v1, _Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	dense_solve<LDLT<MatrixXf>>(m1, row, col, v1, vout);
+}
+
+// must match EigenCore.Core.Dense.BatchLayout.
+enum BatchLayout
+{
+	// matrix n is column-major at values + n * size * size.
+	ContiguousBatch = 0,
+	// entry (i, j) of matrix n is at values + (j * size + i) * count + n, so every
+	// entry forms a plane of count values and the kernels vectorize across the batch.
+	InterleavedBatch = 1
+};
+
+// matrices per block of the interleaved kernels, each entry of a block is one fixed-size array.
+static const int batch_lanes = 128;
+typedef Array<double, batch_lanes, 1> BatchLanes;
+typedef vector<BatchLanes, aligned_allocator<BatchLanes>> BatchBlock;
+
+// scalar work below which a batch stays on the calling thread.
+static int batch_threads(long long work)
+{
+	return work > (1 << 15) ? effective_num_threads() : 1;
+}
+
+static int batch_blocks(int count)
+{
+	return (count + batch_lanes - 1) / batch_lanes;
+}
+
+// copies lanes [first, first + lanes) of every plane into the block, the missing tail lanes
+// are padded with the identity so that they stay well defined.
+static void batch_load(const double* planes, int size, int columns, int count, int first, int lanes, BatchBlock& block)
+{
+	for (int j = 0; j < columns; ++j)
+	{
+		for (int i = 0; i < size; ++i)
+		{
+			BatchLanes& entry = block[j * size + i];
+			entry.head(lanes) = Map<const ArrayXd>(planes + static_cast<long long>(j * size + i) * count + first, lanes);
+			entry.tail(batch_lanes - lanes).setConstant(i == j ? 1.0 : 0.0);
+		}
+	}
+}
+
+static void batch_store(const BatchBlock& block, int size, int columns, int count, int first, int lanes, double* planes)
+{
+	for (int e = 0; e < size * columns; ++e)
+		Map<ArrayXd>(planes + static_cast<long long>(e) * count + first, lanes) = block[e].head(lanes);
+}
+
+// LU with partial pivoting of batch_lanes matrices at once, applied to columns right-hand sides.
+// The innermost loops run over the lanes and the pivot row is picked per lane with conditional
+// moves, so the compiler vectorizes across the batch while every lane picks the same pivots as
+// PartialPivLU. Returns the sign of the row permutation in sign.
+template<int K>
+static void batch_lu(int size, BatchBlock& a, BatchBlock& rhs, int columns, BatchLanes& sign)
+{
+	const int n = K == Dynamic ? size : K;
+	double* s = sign.data();
+	for (int l = 0; l < batch_lanes; ++l)
+		s[l] = 1.0;
+
+	for (int k = 0; k < n; ++k)
+	{
+		BatchLanes best, pivot;
+		double* b = best.data();
+		double* p = pivot.data();
+		const double* diagonal = a[k * n + k].data();
+		for (int l = 0; l < batch_lanes; ++l)
+		{
+			b[l] = std::abs(diagonal[l]);
+			p[l] = k;
+		}
+
+		for (int r = k + 1; r < n; ++r)
+		{
+			const double* candidate = a[k * n + r].data();
+			for (int l = 0; l < batch_lanes; ++l)
+			{
+				const double value = std::abs(candidate[l]);
+				const bool larger = value > b[l];
+				p[l] = larger ? r : p[l];
+				b[l] = larger ? value : b[l];
+			}
+		}
+
+		for (int l = 0; l < batch_lanes; ++l)
+			s[l] = p[l] != k ? -s[l] : s[l];
+
+		for (int r = k + 1; r < n; ++r)
+		{
+			if (!(pivot == static_cast<double>(r)).any())
+				continue;
+
+			for (int j = 0; j < n + columns; ++j)
+			{
+				double* top = j < n ? a[j * n + k].data() : rhs[(j - n) * n + k].data();
+				double* other = j < n ? a[j * n + r].data() : rhs[(j - n) * n + r].data();
+				for (int l = 0; l < batch_lanes; ++l)
+				{
+					const bool swap = p[l] == r;
+					const double value = top[l];
+					top[l] = swap ? other[l] : value;
+					other[l] = swap ? value : other[l];
+				}
+			}
+		}
+
+		const double* pivots = a[k * n + k].data();
+		for (int r = k + 1; r < n; ++r)
+		{
+			double* factor = a[k * n + r].data();
+			for (int l = 0; l < batch_lanes; ++l)
+				factor[l] /= pivots[l];
+			for (int j = k + 1; j < n + columns; ++j)
+			{
+				double* target = j < n ? a[j * n + r].data() : rhs[(j - n) * n + r].data();
+				const double* source = j < n ? a[j * n + k].data() : rhs[(j - n) * n + k].data();
+				for (int l = 0; l < batch_lanes; ++l)
+					target[l] -= factor[l] * source[l];
+			}
+		}
+	}
+
+	// back substitution with U.
+	for (int c = 0; c < columns; ++c)
+	{
+		for (int i = n - 1; i >= 0; --i)
+		{
+			double* x = rhs[c * n + i].data();
+			for (int j = i + 1; j < n; ++j)
+			{
+				const double* u = a[j * n + i].data();
+				const double* y = rhs[c * n + j].data();
+				for (int l = 0; l < batch_lanes; ++l)
+					x[l] -= u[l] * y[l];
+			}
+
+			const double* diagonal = a[i * n + i].data();
+			for (int l = 0; l < batch_lanes; ++l)
+				x[l] /= diagonal[l];
+		}
+	}
+}
+
+template<int K>
+struct BatchMult
+{
+	static void run(int size, int layout, int count, const double* a, const double* b, double* out)
+	{
+		typedef Matrix<double, K, K> MatrixType;
+		const long long step = static_cast<long long>(size) * size;
+		const int threads = batch_threads(step * size * count);
+		if (layout == InterleavedBatch)
+		{
+			const int blocks = batch_blocks(count);
+			const int n = K == Dynamic ? size : K;
+			#pragma omp parallel num_threads(threads)
+			{
+				BatchBlock left(step), right(step), result(step);
+				#pragma omp for schedule(static)
+				for (int block = 0; block < blocks; ++block)
+				{
+					const int first = block * batch_lanes;
+					const int lanes = MIN(batch_lanes, count - first);
+					batch_load(a, size, size, count, first, lanes, left);
+					batch_load(b, size, size, count, first, lanes, right);
+					for (int j = 0; j < n; ++j)
+					{
+						for (int i = 0; i < n; ++i)
+						{
+							double* r = result[j * n + i].data();
+							for (int l = 0; l < batch_lanes; ++l)
+								r[l] = 0.0;
+							for (int k = 0; k < n; ++k)
+							{
+								const double* x = left[k * n + i].data();
+								const double* y = right[j * n + k].data();
+								for (int l = 0; l < batch_lanes; ++l)
+									r[l] += x[l] * y[l];
+							}
+						}
+					}
+					batch_store(result, size, size, count, first, lanes, out);
+				}
+			}
+			return;
+		}
+
+		#pragma omp parallel for schedule(static) num_threads(threads)
+		for (int n = 0; n < count; ++n)
+		{
+			Map<const MatrixType> left(a + n * step, size, size);
+			Map<const MatrixType> right(b + n * step, size, size);
+			Map<MatrixType>(out + n * step, size, size).noalias() = left * right;
+		}
+	}
+};
+
+template<int K>
+struct BatchInverse
+{
+	static void run(int size, int layout, int count, const double* a, double* out)
+	{
+		typedef Matrix<double, K, K> MatrixType;
+		const long long step = static_cast<long long>(size) * size;
+		const int threads = batch_threads(step * size * count);
+		if (layout == InterleavedBatch)
+		{
+			const int blocks = batch_blocks(count);
+			#pragma omp parallel num_threads(threads)
+			{
+				BatchBlock matrix(step), identity(step);
+				BatchLanes sign;
+				#pragma omp for schedule(static)
+				for (int block = 0; block < blocks; ++block)
+				{
+					const int first = block * batch_lanes;
+					const int lanes = MIN(batch_lanes, count - first);
+					batch_load(a, size, size, count, first, lanes, matrix);
+					for (int j = 0; j < size; ++j)
+						for (int i = 0; i < size; ++i)
+							identity[j * size + i].setConstant(i == j ? 1.0 : 0.0);
+					batch_lu<K>(size, matrix, identity, size, sign);
+					batch_store(identity, size, size, count, first, lanes, out);
+				}
+			}
+			return;
+		}
+
+		#pragma omp parallel for schedule(static) num_threads(threads)
+		for (int n = 0; n < count; ++n)
+		{
+			Map<const MatrixType> matrix(a + n * step, size, size);
+			Map<MatrixType>(out + n * step, size, size) = matrix.inverse();
+		}
+	}
+};
+
+template<int K>
+struct BatchDeterminant
+{
+	static void run(int size, int layout, int count, const double* a, double* out)
+	{
+		typedef Matrix<double, K, K> MatrixType;
+		const long long step = static_cast<long long>(size) * size;
+		const int threads = batch_threads(step * size * count);
+		if (layout == InterleavedBatch)
+		{
+			const int blocks = batch_blocks(count);
+			#pragma omp parallel num_threads(threads)
+			{
+				BatchBlock matrix(step), none;
+				BatchLanes sign;
+				#pragma omp for schedule(static)
+				for (int block = 0; block < blocks; ++block)
+				{
+					const int first = block * batch_lanes;
+					const int lanes = MIN(batch_lanes, count - first);
+					batch_load(a, size, size, count, first, lanes, matrix);
+					batch_lu<K>(size, matrix, none, 0, sign);
+					for (int i = 0; i < size; ++i)
+						sign *= matrix[i * size + i];
+					Map<ArrayXd>(out + first, lanes) = sign.head(lanes);
+				}
+			}
+			return;
+		}
+
+		#pragma omp parallel for schedule(static) num_threads(threads)
+		for (int n = 0; n < count; ++n)
+			out[n] = Map<const MatrixType>(a + n * step, size, size).determinant();
+	}
+};
+
+// rhs and out hold one vector per matrix, contiguous: vector n at n * size,
+// interleaved: entry i of vector n at i * count + n.
+template<int K>
+struct BatchSolve
+{
+	static void run(int size, int layout, int count, const double* a, const double* b, double* out)
+	{
+		typedef Matrix<double, K, K> MatrixType;
+		typedef Matrix<double, K, 1> VectorType;
+		const long long step = static_cast<long long>(size) * size;
+		const int threads = batch_threads(step * size * count);
+		if (layout == InterleavedBatch)
+		{
+			const int blocks = batch_blocks(count);
+			#pragma omp parallel num_threads(threads)
+			{
+				BatchBlock matrix(step), rhs(size);
+				BatchLanes sign;
+				#pragma omp for schedule(static)
+				for (int block = 0; block < blocks; ++block)
+				{
+					const int first = block * batch_lanes;
+					const int lanes = MIN(batch_lanes, count - first);
+					batch_load(a, size, size, count, first, lanes, matrix);
+					for (int i = 0; i < size; ++i)
+					{
+						rhs[i].head(lanes) = Map<const ArrayXd>(b + static_cast<long long>(i) * count + first, lanes);
+						rhs[i].tail(batch_lanes - lanes).setZero();
+					}
+					batch_lu<K>(size, matrix, rhs, 1, sign);
+					batch_store(rhs, size, 1, count, first, lanes, out);
+				}
+			}
+			return;
+		}
+
+		#pragma omp parallel for schedule(static) num_threads(threads)
+		for (int n = 0; n < count; ++n)
+		{
+			Map<const MatrixType> matrix(a + n * step, size, size);
+			Map<const VectorType> rhs(b + static_cast<long long>(n) * size, size);
+			Map<VectorType>(out + static_cast<long long>(n) * size, size) = matrix.partialPivLu().solve(rhs);
+		}
+	}
+};
+
+// fixed-size kernels for the common element sizes, dynamic size otherwise.
+template<template<int> class Kernel, typename... Args>
+static void batch_dispatch(int size, Args... args)
+{
+	switch (size)
+	{
+	case 2: Kernel<2>::run(size, args...); break;
+	case 3: Kernel<3>::run(size, args...); break;
+	case 4: Kernel<4>::run(size, args...); break;
+	case 5: Kernel<5>::run(size, args...); break;
+	case 6: Kernel<6>::run(size, args...); break;
+	default: Kernel<Dynamic>::run(size, args...); break;
+	}
+}
+
+// out_n = a_n * b_n for count size x size matrices.
+EXPORT_API(void) dbatch_mult_(int layout, const int size, const int count, _In_ double* a, _In_ double* b, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(size * count, size, 0);
+	batch_dispatch<BatchMult>(size, layout, count, static_cast<const double*>(a), static_cast<const double*>(b), vout);
+}
+
+EXPORT_API(void) dbatch_inverse_(int layout, const int size, const int count, _In_ double* a, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(size * count, size, 0);
+	batch_dispatch<BatchInverse>(size, layout, count, static_cast<const double*>(a), vout);
+}
+
+// one determinant per matrix.
+EXPORT_API(void) dbatch_determinant_(int layout, const int size, const int count, _In_ double* a, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(size * count, size, 0);
+	batch_dispatch<BatchDeterminant>(size, layout, count, static_cast<const double*>(a), vout);
+}
+
+// a_n x_n = b_n with partial pivoting.
+EXPORT_API(void) dbatch_solve_(int layout, const int size, const int count, _In_ double* a, _In_ double* b, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(size * count, size, 0);
+	batch_dispatch<BatchSolve>(size, layout, count, static_cast<const double*>(a), static_cast<const double*>(b), vout);
+}
+
+// must match EigenCore.Core.Sparse.LinearAlgebra.IterativeSolverType.
+enum IterativeSolverType
+{
+	ConjugateGradientSolver = 0,
+	BiCGSTABSolver = 1,
+	LeastSquaresConjugateGradientSolver = 2,
+	GMRESSolver = 3,
+	DGMRESSolver = 4,
+	MINRESSolver = 5
+};
+
+// must match EigenCore.Core.Sparse.LinearAlgebra.PreconditionerType.
+enum PreconditionerType
+{
+	DefaultPreconditioning = 0,
+	DiagonalPreconditioning = 1,
+	IdentityPreconditioning = 2,
+	IncompleteLUTPreconditioning = 3,
+	IncompleteCholeskyPreconditioning = 4
+};
+
+// fillFactor, dropTolerance and shift <= 0 keep Eigen's defaults.
+template<typename Preconditioner>
+static void configure_preconditioner(Preconditioner&, int, double, double)
+{
+}
+
+template<typename Scalar>
+static void configure_preconditioner(IncompleteLUT<Scalar>& preconditioner, int fillFactor, double dropTolerance, double)
+{
+	if (fillFactor > 0) {
+		preconditioner.setFillfactor(fillFactor);
+	}
+
+	if (dropTolerance > 0) {
+		preconditioner.setDroptol(dropTolerance);
+	}
+}
+
+template<typename Scalar>
+static void configure_preconditioner(IncompleteCholesky<Scalar>& preconditioner, int, double, double shift)
+{
+	if (shift > 0) {
+		preconditioner.setInitialShift(shift);
+	}
+}
+
+// Progress of an iterative solve (must match EigenCore.Core.Sparse.LinearAlgebra.IterativeSolverMonitor).
+// Every interval iterations the relative residual |b - A x| / |b| of the current iterate is
+// appended to history (with its iteration in historyIterations) and passed to callback, a
+// nonzero return stops the solve. history and callback are optional, historyCount and
+// stopped are written by the solve; the final iterate is always appended to the history.
+typedef int (*IterativeProgressCallback)(int iteration, double residual);
+
+struct IterativeMonitor
+{
+	int interval;
+	int historyCapacity;
+	int* historyIterations;
+	double* history;
+	int historyCount;
+	IterativeProgressCallback callback;
+	int stopped;
+};
+
+class IterationObserver
+{
+public:
+	virtual ~IterationObserver() {}
+	virtual void applied() = 0;
+};
+
+// Eigen's Krylov loops have no per iteration hook, but each of them applies the
+// preconditioner at fixed points of an iteration. The wrapper reports every application
+// to the observer of the running solve, without one it only costs a branch.
+template<typename Preconditioner>
+class MonitoredPreconditioner : public Preconditioner
+{
+public:
+	template<typename Rhs>
+	decltype(auto) solve(const Rhs& b) const
+	{
+		if (observer != nullptr) {
+			observer->applied();
+		}
+
+		return Preconditioner::solve(b);
+	}
+
+	IterationObserver* observer = nullptr;
+};
+
+template<typename Preconditioner>
+static void configure_preconditioner(MonitoredPreconditioner<Preconditioner>& preconditioner, int fillFactor, double dropTolerance, double shift)
+{
+	configure_preconditioner(static_cast<Preconditioner&>(preconditioner), fillFactor, dropTolerance, shift);
+}
+
+// least squares conjugate gradient works on A^T A, incomplete factorizations
+// of A do not apply and fall back to the diagonal of A^T A.
+template<typename Scalar, typename Preconditioner>
+struct least_squares_preconditioner
+{
+	typedef LeastSquareDiagonalPreconditioner<Scalar> type;
+};
+
+template<typename Scalar>
+struct least_squares_preconditioner<Scalar, IdentityPreconditioner>
+{
+	typedef IdentityPreconditioner type;
+};
+
+// solver types by scalar and preconditioner, DGMRES is served by MINRES.
+template<typename Scalar, typename Preconditioner>
+using ConjugateGradientOf = ConjugateGradient<SparseMatrix<Scalar>, Lower, MonitoredPreconditioner<Preconditioner>>;
+
+template<typename Scalar, typename Preconditioner>
+using BiCGSTABOf = BiCGSTAB<SparseMatrix<Scalar>, MonitoredPreconditioner<Preconditioner>>;
+
+template<typename Scalar, typename Preconditioner>
+using LeastSquaresConjugateGradientOf = LeastSquaresConjugateGradient<SparseMatrix<Scalar>,
+	MonitoredPreconditioner<typename least_squares_preconditioner<Scalar, Preconditioner>::type>>;
+
+template<typename Scalar, typename Preconditioner>
+using GMRESOf = GMRES<SparseMatrix<Scalar>, MonitoredPreconditioner<Preconditioner>>;
+
+template<typename Scalar, typename Preconditioner>
+using MINRESOf = MINRES<SparseMatrix<Scalar>, Lower, MonitoredPreconditioner<Preconditioner>>;
+
+// Preconditioner applications before the iterate has completed its first iteration (lead)
+// and per iteration. CG and least squares CG apply it once before the loop and once after
+// each update of x, MINRES once before the loop and once per iteration ahead of the update,
+// BiCGSTAB twice per iteration. GMRES only updates x at a restart, which applies it once
+// more after every restart iterations; those are the only points where it is reported.
+struct IterationSchedule
+{
+	int lead;
+	int perIteration;
+	int restart;
+};
+
+template<typename Solver>
+static IterationSchedule iteration_schedule(Solver&)
+{
+	return { 1, 1, 0 };
+}
+
+template<typename MatrixType, int UpLo, typename Preconditioner>
+static IterationSchedule iteration_schedule(MINRES<MatrixType, UpLo, Preconditioner>&)
+{
+	return { 2, 1, 0 };
+}
+
+template<typename MatrixType, typename Preconditioner>
+static IterationSchedule iteration_schedule(BiCGSTAB<MatrixType, Preconditioner>&)
+{
+	return { 1, 2, 0 };
+}
+
+template<typename MatrixType, typename Preconditioner>
+static IterationSchedule iteration_schedule(GMRES<MatrixType, Preconditioner>& solver)
+{
+	return { 1, 1, (int)solver.get_restart() };
+}
+
+// thrown through the solver loop when the callback asks to stop.
+struct IterationStopped
+{
+};
+
+// Maps preconditioner applications to completed iterations and reports the residual of the
+// iterate, which the solvers update in place in the destination vector.
+template<typename MatrixType, typename Scalar>
+class IterationTracker : public IterationObserver
+{
+public:
+	IterationTracker(IterativeMonitor& monitor, IterationSchedule schedule, const MatrixType& matrix,
+		const Map<const DenseVector<Scalar>>& rhs, const Map<DenseVector<Scalar>>& x)
+		: monitor(monitor), schedule(schedule), matrix(matrix), rhs(rhs), x(x),
+		interval(monitor.interval > 0 ? monitor.interval : 1), rhsNorm(rhs.norm())
+	{
+		monitor.historyCount = 0;
+		monitor.stopped = 0;
+	}
+
+	void applied() override
+	{
+		const int k = ++applications - schedule.lead;
+		if (k <= 0) {
+			return;
+		}
+
+		int completed;
+		if (schedule.restart > 0) {
+			if (k % (schedule.restart + 1) != 0) {
+				return;
+			}
+
+			completed = k / (schedule.restart + 1) * schedule.restart;
+		}
+		else {
+			if (k % schedule.perIteration != 0) {
+				return;
+			}
+
+			completed = k / schedule.perIteration;
+		}
+
+		if (completed < reported + interval) {
+			return;
+		}
+
+		record(completed);
+		if (monitor.callback != nullptr && monitor.callback(completed, residual) != 0) {
+			monitor.stopped = 1;
+			throw IterationStopped();
+		}
+	}
+
+	// the final iterate, unless it was the last one reported.
+	void finish(int iterations)
+	{
+		if (monitor.historyCount == 0 || iterations != reported) {
+			record(iterations);
+		}
+	}
+
+	int iteration() const { return reported; }
+	double error() const { return residual; }
+
+private:
+	void record(int iteration)
+	{
+		const double norm = (rhs - matrix * x).norm();
+		residual = rhsNorm > 0 ? norm / rhsNorm : norm;
+		reported = iteration;
+		if (monitor.history != nullptr && monitor.historyCount < monitor.historyCapacity) {
+			if (monitor.historyIterations != nullptr) {
+				monitor.historyIterations[monitor.historyCount] = iteration;
+			}
+
+			monitor.history[monitor.historyCount++] = residual;
+		}
+	}
+
+	IterativeMonitor& monitor;
+	const IterationSchedule schedule;
+	const MatrixType& matrix;
+	const Map<const DenseVector<Scalar>>& rhs;
+	const Map<DenseVector<Scalar>>& x;
+	const int interval;
+	const double rhsNorm;
+	int applications = 0;
+	int reported = 0;
+	double residual = 0;
+};
+
+// solve with a computed solver. When x0 is given the solver starts from it
+// (solveWithGuess) instead of x = 0. With a monitor the solve reports its progress
+// (see IterativeMonitor), a stopped solve keeps its last iterate and returns false.
+template<typename Solver, typename MatrixType, typename Scalar>
+static bool iterative_solve_with(
+	Solver& solver,
+	const MatrixType& matrix,
+	int maxIterations,
+	double tolerance,
+	const Map<const DenseVector<Scalar>>& rhs,
+	Scalar* x0,
+	Map<DenseVector<Scalar>>& x,
+	int* iterations,
+	double* error,
+	IterativeMonitor* monitor) {
+
+	solver.setMaxIterations(maxIterations > 0 ? maxIterations : -1);
+	solver.setTolerance(tolerance > 0 ? tolerance : NumTraits<Scalar>::epsilon());
+
+	unique_ptr<IterationTracker<MatrixType, Scalar>> tracker;
+	if (monitor != nullptr) {
+		tracker.reset(new IterationTracker<MatrixType, Scalar>(*monitor, iteration_schedule(solver), matrix, rhs, x));
+	}
+
+	if (x0 != nullptr) {
+		Map<const DenseVector<Scalar>> guess(x0, x.size());
+
+		// a guess that already meets the tolerance is returned as is, MINRES
+		// would otherwise divide by the zero initial residual.
+		double rhsNorm = rhs.norm();
+		double residualNorm = (rhs - matrix * guess).norm();
+		if (residualNorm <= solver.tolerance() * rhsNorm) {
+			x = guess;
+			*iterations = 0;
+			*error = rhsNorm > 0 ? residualNorm / rhsNorm : 0;
+			if (tracker) {
+				tracker->finish(0);
+			}
+
+			return true;
+		}
+	}
+
+	solver.preconditioner().observer = tracker.get();
+	try {
+		if (x0 != nullptr) {
+			x = solver.solveWithGuess(rhs, Map<const DenseVector<Scalar>>(x0, x.size()));
+		}
+		else {
+			x = solver.solve(rhs);
+		}
+	}
+	catch (const IterationStopped&) {
+		solver.preconditioner().observer = nullptr;
+		*iterations = tracker->iteration();
+		*error = tracker->error();
+		return false;
+	}
+
+	solver.preconditioner().observer = nullptr;
+	*iterations = (int)solver.iterations();
+	*error = solver.error();
+	if (tracker) {
+		tracker->finish(*iterations);
+	}
+
+	return solver.info() == Success;
+}
+
+template<typename Solver, typename MatrixType>
+static bool iterative_compute(Solver& solver, const MatrixType& matrix, int fillFactor, double dropTolerance, double shift)
+{
+	configure_preconditioner(solver.preconditioner(), fillFactor, dropTolerance, shift);
+	solver.compute(matrix);
+	return solver.info() == Success;
+}
+
+template<typename Solver, typename Scalar>
+static bool iterative_solve(
+	const Map<const SparseMatrix<Scalar>>& matrix,
+	int maxIterations,
+	double tolerance,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	const Map<const DenseVector<Scalar>>& rhs,
+	Scalar* x0,
+	Map<DenseVector<Scalar>>& x,
+	int* iterations,
+	double* error,
+	IterativeMonitor* monitor) {
+
+	Solver solver;
+	if (!iterative_compute(solver, matrix, fillFactor, dropTolerance, shift)) {
+		*iterations = 0;
+		*error = numeric_limits<double>::quiet_NaN();
+		return false;
+	}
+
+	return iterative_solve_with(solver, matrix, maxIterations, tolerance, rhs, x0, x, iterations, error, monitor);
+}
+
+// Shared body of the iterative solver exports, DefaultPreconditioner is the
+// one Eigen picks for the solver.
+template<template<typename, typename> class SolverOf, PreconditionerType DefaultPreconditioner, typename Scalar>
+static bool iterative_solve(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	int* outerIndex,
+	int* innerIndex,
+	Scalar* values,
+	Scalar* inrhs,
+	int size,
+	Scalar* x0,
+	Scalar* vout,
+	int* iterations,
+	double* error,
+	IterativeMonitor* monitor) {
+
+	Map<const SparseMatrix<Scalar>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<const DenseVector<Scalar>> rhs(inrhs, size);
+	Map<DenseVector<Scalar>> x(vout, size);
+
+	switch (preconditioner == DefaultPreconditioning ? DefaultPreconditioner : preconditioner)
+	{
+	case IdentityPreconditioning:
+		return iterative_solve<SolverOf<Scalar, IdentityPreconditioner>>(matrix, maxIterations, tolerance,
+			fillFactor, dropTolerance, shift, rhs, x0, x, iterations, error, monitor);
+	case IncompleteLUTPreconditioning:
+		return iterative_solve<SolverOf<Scalar, IncompleteLUT<Scalar>>>(matrix, maxIterations, tolerance,
+			fillFactor, dropTolerance, shift, rhs, x0, x, iterations, error, monitor);
+	case IncompleteCholeskyPreconditioning:
+		return iterative_solve<SolverOf<Scalar, IncompleteCholesky<Scalar>>>(matrix, maxIterations, tolerance,
+			fillFactor, dropTolerance, shift, rhs, x0, x, iterations, error, monitor);
+	case DiagonalPreconditioning:
+	default:
+		return iterative_solve<SolverOf<Scalar, DiagonalPreconditioner<Scalar>>>(matrix, maxIterations, tolerance,
+			fillFactor, dropTolerance, shift, rhs, x0, x, iterations, error, monitor);
+	}
+}
+
+// Iterative solver together with its preconditioner. The solver keeps a
+// reference to the matrix, so the matrix is copied and owned here; the
+// preconditioner is built once by compute and reused by every solve.
+class IterativeSolver
+{
+public:
+	virtual ~IterativeSolver() {}
+	virtual bool compute(const Map<const SparseMatrix<double>>& matrix, int fillFactor, double dropTolerance, double shift) = 0;
+	virtual bool solve(int maxIterations, double tolerance, const Map<const VectorXd>& rhs, double* x0,
+		Map<VectorXd>& x, int* iterations, double* error, IterativeMonitor* monitor) = 0;
+};
+
+template<typename Solver>
+class IterativeSolverImpl : public IterativeSolver
+{
+public:
+	bool compute(const Map<const SparseMatrix<double>>& matrix, int fillFactor, double dropTolerance, double shift) override
+	{
+		this->matrix = matrix;
+		return iterative_compute(solver, this->matrix, fillFactor, dropTolerance, shift);
+	}
+
+	bool solve(int maxIterations, double tolerance, const Map<const VectorXd>& rhs, double* x0,
+		Map<VectorXd>& x, int* iterations, double* error, IterativeMonitor* monitor) override
+	{
+		return iterative_solve_with(solver, matrix, maxIterations, tolerance, rhs, x0, x, iterations, error, monitor);
+	}
+
+private:
+	SparseMatrix<double> matrix;
+	Solver solver;
+};
+
+template<template<typename, typename> class SolverOf, PreconditionerType DefaultPreconditioner>
+static IterativeSolver* iterative_solver_create(int preconditioner)
+{
+	switch (preconditioner == DefaultPreconditioning ? DefaultPreconditioner : preconditioner)
+	{
+	case IdentityPreconditioning:
+		return new IterativeSolverImpl<SolverOf<double, IdentityPreconditioner>>();
+	case IncompleteLUTPreconditioning:
+		return new IterativeSolverImpl<SolverOf<double, IncompleteLUT<double>>>();
+	case IncompleteCholeskyPreconditioning:
+		return new IterativeSolverImpl<SolverOf<double, IncompleteCholesky<double>>>();
+	case DiagonalPreconditioning:
+	default:
+		return new IterativeSolverImpl<SolverOf<double, DiagonalPreconditioner<double>>>();
+	}
+}
+
+static IterativeSolver* iterative_solver_create(int solverType, int preconditioner)
+{
+	switch (solverType)
+	{
+	case BiCGSTABSolver:
+		return iterative_solver_create<BiCGSTABOf, DiagonalPreconditioning>(preconditioner);
+	case LeastSquaresConjugateGradientSolver:
+		return iterative_solver_create<LeastSquaresConjugateGradientOf, DiagonalPreconditioning>(preconditioner);
+	case GMRESSolver:
+		return iterative_solver_create<GMRESOf, DiagonalPreconditioning>(preconditioner);
+	case DGMRESSolver:
+	case MINRESSolver:
+		return iterative_solver_create<MINRESOf, IdentityPreconditioning>(preconditioner);
+	case ConjugateGradientSolver:
+	default:
+		return iterative_solver_create<ConjugateGradientOf, DiagonalPreconditioning>(preconditioner);
+	}
+}
+
+// Triplet to compressed column assembly in O(count + row + col): a counting sort by row
+// followed by a stable counting sort by column leaves every column sorted by row, duplicates
+// are then summed in place. innerIndex and valuesout hold count entries; returns the number
+// of non zeros.
+template<typename Scalar>
+static int sparse_from_triplets(int row, int col, int count,
+	const int* rowIndices, const int* colIndices, const Scalar* values,
+	int* outerIndex, int* innerIndex, Scalar* valuesout)
+{
+	vector<int> rowStart(row + 1, 0);
+	for (int t = 0; t < count; ++t)
+		++rowStart[rowIndices[t] + 1];
+	partial_sum(rowStart.begin(), rowStart.end(), rowStart.begin());
+
+	vector<int> order(count);
+	for (int t = 0; t < count; ++t)
+		order[rowStart[rowIndices[t]]++] = t;
+
+	fill(outerIndex, outerIndex + (col + 1), 0);
+	for (int t = 0; t < count; ++t)
+		++outerIndex[colIndices[t] + 1];
+	partial_sum(outerIndex, outerIndex + (col + 1), outerIndex);
+
+	vector<int> next(outerIndex, outerIndex + col);
+	for (int t : order)
+	{
+		const int k = next[colIndices[t]]++;
+		innerIndex[k] = rowIndices[t];
+		valuesout[k] = values[t];
+	}
+
+	int nnz = 0;
+	for (int j = 0; j < col; ++j)
+	{
+		const int first = outerIndex[j];
+		const int end = outerIndex[j + 1];
+		outerIndex[j] = nnz;
+		for (int k = first; k < end; ++k)
+		{
+			if (nnz > outerIndex[j] && innerIndex[nnz - 1] == innerIndex[k])
+			{
+				valuesout[nnz - 1] += valuesout[k];
+				continue;
+			}
+
+			innerIndex[nnz] = innerIndex[k];
+			valuesout[nnz++] = valuesout[k];
+		}
+	}
+	outerIndex[col] = nnz;
+	return nnz;
+}
+
+// symbolic phase of A + B and A - B: column pointers of the union of both patterns,
+// returns the exact number of non zeros. Inner indices must be sorted within each column.
+static int sparse_union_pattern(int col,
+	const int* outerIndex1, const int* innerIndex1,
+	const int* outerIndex2, const int* innerIndex2,
+	int* outerIndex)
+{
+	int nnz = 0;
+	outerIndex[0] = 0;
+	for (int j = 0; j < col; ++j)
+	{
+		int p = outerIndex1[j], q = outerIndex2[j];
+		const int pend = outerIndex1[j + 1], qend = outerIndex2[j + 1];
+		while (p < pend && q < qend)
+		{
+			const int i1 = innerIndex1[p], i2 = innerIndex2[q];
+			p += i1 <= i2;
+			q += i2 <= i1;
+			++nnz;
+		}
+		nnz += (pend - p) + (qend - q);
+		outerIndex[j + 1] = nnz;
+	}
+	return nnz;
+}
+
+// numeric phase of A op B, writes straight into the pattern computed by sparse_union_pattern.
+template<typename Scalar, typename BinaryOp>
+static void sparse_union_values(int col,
+	const int* outerIndex1, const int* innerIndex1, const Scalar* values1,
+	const int* outerIndex2, const int* innerIndex2, const Scalar* values2,
+	const int* outerIndex, int* innerIndex, Scalar* values, BinaryOp op)
+{
+	for (int j = 0; j < col; ++j)
+	{
+		int k = outerIndex[j];
+		int p = outerIndex1[j], q = outerIndex2[j];
+		const int pend = outerIndex1[j + 1], qend = outerIndex2[j + 1];
+		while (p < pend || q < qend)
+		{
+			const int i1 = p < pend ? innerIndex1[p] : INT_MAX;
+			const int i2 = q < qend ? innerIndex2[q] : INT_MAX;
+			if (i1 < i2)
+			{
+				innerIndex[k] = i1;
+				values[k] = op(values1[p++], Scalar(0));
+			}
+			else if (i2 < i1)
+			{
+				innerIndex[k] = i2;
+				values[k] = op(Scalar(0), values2[q++]);
+			}
+			else
+			{
+				innerIndex[k] = i1;
+				values[k] = op(values1[p++], values2[q++]);
+			}
+			++k;
+		}
+	}
+}
+
+template<typename Scalar>
+static void sparse_add(
+	int row, int col,
+	int nnz1, int* outerIndex1, int* innerIndex1, Scalar* values1,
+	int nnz2, int* outerIndex2, int* innerIndex2, Scalar* values2,
+	const int* outerIndex, int* innerIndex, Scalar* values) {
+
+	sparse_union_values(col, outerIndex1, innerIndex1, values1, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values, plus<Scalar>());
+}
+
+template<typename Scalar>
+static void sparse_minus(
+	int row, int col,
+	int nnz1, int* outerIndex1, int* innerIndex1, Scalar* values1,
+	int nnz2, int* outerIndex2, int* innerIndex2, Scalar* values2,
+	const int* outerIndex, int* innerIndex, Scalar* values) {
+
+	sparse_union_values(col, outerIndex1, innerIndex1, values1, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values, minus<Scalar>());
+}
+
+// Gustavson sparse product C = A * B, one column of C per column of B. Columns are split into
+// contiguous ranges of about the same number of multiply-adds, one per thread; every thread
+// keeps its own dense marker and accumulator over the rows of A and writes only its own
+// columns of C, so the two phases only meet at the prefix sum of the column counts.
+class SparseProductPartition
+{
+public:
+	SparseProductPartition(int col, const int* outerIndex1, const int* outerIndex2, const int* innerIndex2)
+		: columns(col), work(col + 1, 0)
+	{
+		// one unit per column keeps empty columns from piling up on the last thread.
+		for (int j = 0; j < col; ++j)
+		{
+			long long flops = 1;
+			for (int q = outerIndex2[j]; q < outerIndex2[j + 1]; ++q)
+				flops += outerIndex1[innerIndex2[q] + 1] - outerIndex1[innerIndex2[q]];
+			work[j + 1] = work[j] + flops;
+		}
+
+		threads = work[col] > (1 << 15) ? effective_num_threads() : 1;
+	}
+
+	int num_threads() const { return threads; }
+
+	// first column of the given part.
+	int first_column(int part, int parts) const
+	{
+		if (part >= parts)
+			return columns;
+
+		const long long target = work[columns] * part / parts;
+		return static_cast<int>(lower_bound(work.begin(), work.end(), target) - work.begin());
+	}
+
+	template<typename Function>
+	void run(Function function) const
+	{
+#ifdef EIGEN_HAS_OPENMP
+		if (threads > 1)
+		{
+			#pragma omp parallel num_threads(threads)
+			{
+				const int part = omp_get_thread_num();
+				const int parts = omp_get_num_threads();
+				function(first_column(part, parts), first_column(part + 1, parts));
+			}
+			return;
+		}
+#endif
+		function(0, columns);
+	}
+
+private:
+	int columns;
+	int threads;
+	vector<long long> work;
+};
+
+// symbolic phase of A * B: column pointers of the product pattern, returns the exact number
+// of non zeros.
+static int sparse_product_pattern(int row, int col,
+	const int* outerIndex1, const int* innerIndex1,
+	const int* outerIndex2, const int* innerIndex2,
+	int* outerIndex)
+{
+	SparseProductPartition partition(col, outerIndex1, outerIndex2, innerIndex2);
+	partition.run([&](int begin, int end)
+	{
+		vector<int> mark(row, -1);
+		for (int j = begin; j < end; ++j)
+		{
+			int count = 0;
+			for (int q = outerIndex2[j]; q < outerIndex2[j + 1]; ++q)
+			{
+				const int k = innerIndex2[q];
+				for (int p = outerIndex1[k]; p < outerIndex1[k + 1]; ++p)
+				{
+					const int i = innerIndex1[p];
+					if (mark[i] != j)
+					{
+						mark[i] = j;
+						++count;
+					}
+				}
+			}
+			outerIndex[j + 1] = count;
+		}
+	});
+
+	outerIndex[0] = 0;
+	for (int j = 0; j < col; ++j)
+		outerIndex[j + 1] += outerIndex[j];
+	return outerIndex[col];
+}
+
+// numeric phase of A * B, writes straight into the pattern computed by sparse_product_pattern
+// with sorted inner indices. Entries with magnitude <= dropTolerance are pruned when
+// dropTolerance > 0, the columns are then packed and outerIndex updated; returns the number
+// of non zeros kept.
+template<typename Scalar>
+static int sparse_product_values(int row, int col,
+	const int* outerIndex1, const int* innerIndex1, const Scalar* values1,
+	const int* outerIndex2, const int* innerIndex2, const Scalar* values2,
+	int* outerIndex, int* innerIndex, Scalar* values, double dropTolerance = 0.0)
+{
+	const bool prune = dropTolerance > 0.0;
+	vector<int> kept(prune ? col : 0);
+	SparseProductPartition partition(col, outerIndex1, outerIndex2, innerIndex2);
+	partition.run([&](int begin, int end)
+	{
+		vector<int> mark(row, -1);
+		vector<Scalar> accumulator(row);
+		for (int j = begin; j < end; ++j)
+		{
+			const int first = outerIndex[j];
+			int k = first;
+			for (int q = outerIndex2[j]; q < outerIndex2[j + 1]; ++q)
+			{
+				const Scalar b = values2[q];
+				const int l = innerIndex2[q];
+				for (int p = outerIndex1[l]; p < outerIndex1[l + 1]; ++p)
+				{
+					const int i = innerIndex1[p];
+					if (mark[i] != j)
+					{
+						mark[i] = j;
+						innerIndex[k++] = i;
+						accumulator[i] = values1[p] * b;
+					}
+					else
+					{
+						accumulator[i] += values1[p] * b;
+					}
+				}
+			}
+
+			sort(innerIndex + first, innerIndex + k);
+			if (!prune)
+			{
+				for (int t = first; t < k; ++t)
+					values[t] = accumulator[innerIndex[t]];
+				continue;
+			}
+
+			int last = first;
+			for (int t = first; t < k; ++t)
+			{
+				const int i = innerIndex[t];
+				if (abs(accumulator[i]) > dropTolerance)
+				{
+					innerIndex[last] = i;
+					values[last++] = accumulator[i];
+				}
+			}
+			kept[j] = last - first;
+		}
+	});
+
+	if (!prune)
+		return outerIndex[col];
+
+	int nnz = 0;
+	for (int j = 0; j < col; ++j)
+	{
+		const int first = outerIndex[j];
+		outerIndex[j] = nnz;
+		move(innerIndex + first, innerIndex + first + kept[j], innerIndex + nnz);
+		move(values + first, values + first + kept[j], values + nnz);
+		nnz += kept[j];
+	}
+	outerIndex[col] = nnz;
+	return nnz;
+}
+
+template<typename Scalar>
+static void sparse_multv(int row, int col, int nnz, int* outerIndex, int* innerIndex, Scalar* values,
+	const Scalar* v1, int length, Scalar* vout)
+{
+	Map<const SparseMatrix<Scalar>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<const DenseVector<Scalar>> vector(v1, length);
+	Map<DenseVector<Scalar>> result(vout, row);
+	result = matrix * vector;
+}
+
+// counting sort of the column storage by row, writes straight into the caller's buffers.
+template<typename Scalar>
+static void sparse_transpose(int row, int col, int nnz, int* outerIndex, int* innerIndex, Scalar* values,
+	int* outerIndexout, int* innerIndexout, Scalar* valuesout)
+{
+	fill(outerIndexout, outerIndexout + (row + 1), 0);
+	for (int p = outerIndex[0]; p < outerIndex[col]; ++p)
+		++outerIndexout[innerIndex[p] + 1];
+	partial_sum(outerIndexout, outerIndexout + (row + 1), outerIndexout);
+
+	vector<int> next(outerIndexout, outerIndexout + row);
+	for (int j = 0; j < col; ++j)
+	{
+		for (int p = outerIndex[j]; p < outerIndex[j + 1]; ++p)
+		{
+			const int k = next[innerIndex[p]]++;
+			innerIndexout[k] = j;
+			valuesout[k] = values[p];
+		}
+	}
+}
+
+template<typename Scalar>
+static Scalar sparse_norm(int row, int col, int nnz, int* outerIndex, int* innerIndex, Scalar* values)
+{
+	Map<const SparseMatrix<Scalar>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return matrix.norm();
+}
+
+template<typename Scalar>
+static Scalar sparse_squared_norm(int row, int col, int nnz, int* outerIndex, int* innerIndex, Scalar* values)
+{
+	Map<const SparseMatrix<Scalar>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return matrix.squaredNorm();
+}
+
+// Phase timing and fill-in of a sparse direct solve, must match
+// EigenCore.Core.Sparse.LinearAlgebra.DirectSolverStats.
+struct SparseDirectStats
+{
+	int info;
+	int ordering;
+	double orderingSeconds;
+	double symbolicSeconds;
+	double numericSeconds;
+	double solveSeconds;
+	long long nnzL;
+	long long nnzU;
+	long long workspaceBytes;
+};
+
+// must match EigenCore.Core.Sparse.LinearAlgebra.SparseOrdering.
+enum SparseOrderingType
+{
+	SparseOrderingNatural = 0,
+	SparseOrderingAMD = 1,
+	SparseOrderingCOLAMD = 2
+};
+
+static double seconds_since(chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static thread_local double sparse_ordering_seconds = 0.0;
+
+// the solvers compute their fill-reducing ordering inside analyzePattern, this wrapper
+// adds its run time to sparse_ordering_seconds so that it can be told apart from the symbolic analysis.
+template<typename Ordering>
+struct TimedOrdering
+{
+	typedef typename Ordering::PermutationType PermutationType;
+
+	template<typename MatrixType>
+	void operator()(const MatrixType& matrix, PermutationType& perm)
+	{
+		const auto start = chrono::steady_clock::now();
+		Ordering()(matrix, perm);
+		sparse_ordering_seconds += seconds_since(start);
+	}
+};
+
+template<typename MatrixType>
+static long long sparse_storage_bytes(const MatrixType& matrix)
+{
+	typedef typename MatrixType::Scalar Scalar;
+	typedef typename MatrixType::StorageIndex StorageIndex;
+	return static_cast<long long>((matrix.outerSize() + 1) * sizeof(StorageIndex) +
+		matrix.data().allocatedSize() * (sizeof(Scalar) + sizeof(StorageIndex)));
+}
+
+// The solvers below only add accessors to the factors and work arrays Eigen keeps protected.
+// workspaceBytes counts the factors as allocated, the permuted copy of the input and the work
+// vectors of the factorization; the scratch space of the ordering is not included.
+
+// SimplicialLLT or SimplicialLDLT; L of LDLT is unit lower, its diagonal holds D.
+template<typename Base>
+class SimplicialStatsSolver : public Base
+{
+public:
+	typedef typename Base::Scalar Scalar;
+	typedef typename Base::StorageIndex StorageIndex;
+	static const int ordering = SparseOrderingAMD;
+
+	long long nnzL() const { return this->m_matrix.nonZeros() + this->m_diag.size(); }
+	long long nnzU() const { return nnzL(); }
+
+	long long workspaceBytes(long long nnz) const
+	{
+		const long long n = this->m_matrix.cols();
+		return sparse_storage_bytes(this->m_matrix) + this->m_diag.size() * sizeof(Scalar) +
+			(n + 1 + nnz) * sizeof(StorageIndex) + nnz * sizeof(Scalar) +
+			// P, Pinv, parent, nonZerosPerCol, tags and pattern, y.
+			6 * n * sizeof(StorageIndex) + n * sizeof(Scalar);
+	}
+};
+
+// supernodal SparseLU, the symbolic factorization runs interleaved with the numeric one.
+template<typename Base>
+class SparseLUStatsSolver : public Base
+{
+public:
+	typedef typename Base::Scalar Scalar;
+	typedef typename Base::StorageIndex StorageIndex;
+	static const int ordering = SparseOrderingCOLAMD;
+
+	long long nnzL() const { return this->m_nnzL; }
+	long long nnzU() const { return this->m_nnzU; }
+
+	long long workspaceBytes(long long) const
+	{
+		const auto& glu = this->m_glu;
+		Index m = this->rows();
+		Index n = this->cols();
+		Index panel = this->m_perfv.panel_size;
+		Index maxsuper = this->m_perfv.maxsuper;
+		return static_cast<long long>((glu.lusup.size() + glu.ucol.size()) * sizeof(Scalar) +
+			(glu.lsub.size() + glu.usub.size() + 5 * (n + 1)) * sizeof(StorageIndex) +
+			sparse_storage_bytes(this->m_mat) + n * sizeof(StorageIndex) +
+			internal::LUTempSpace<Scalar>(m, panel) + internal::LUnumTempV(m, panel, maxsuper, m) * sizeof(Scalar));
+	}
+};
+
+// SparseQR, nnzL counts the Householder vectors of Q and nnzU the nonzeros of R.
+template<typename Base>
+class SparseQRStatsSolver : public Base
+{
+public:
+	typedef typename Base::Scalar Scalar;
+	typedef typename Base::StorageIndex StorageIndex;
+	static const int ordering = SparseOrderingCOLAMD;
+
+	long long nnzL() const { return this->m_Q.nonZeros(); }
+	long long nnzU() const { return this->m_R.nonZeros(); }
+
+	long long workspaceBytes(long long) const
+	{
+		const long long m = this->rows();
+		const long long n = this->cols();
+		return sparse_storage_bytes(this->m_pmat) + sparse_storage_bytes(this->m_R) + sparse_storage_bytes(this->m_Q) +
+			this->m_hcoeffs.size() * sizeof(Scalar) +
+			// mark, Ridx, Qidx, etree, firstRowElt, tval.
+			(2 * std::max(m, n) + 2 * n + m) * sizeof(StorageIndex) + m * sizeof(Scalar);
+	}
+};
+
+template<typename Scalar>
+using SimplicialLLTStats = SimplicialStatsSolver<SimplicialLLT<SparseMatrix<Scalar>, Lower, TimedOrdering<AMDOrdering<int>>>>;
+template<typename Scalar>
+using SimplicialLDLTStats = SimplicialStatsSolver<SimplicialLDLT<SparseMatrix<Scalar>, Lower, TimedOrdering<AMDOrdering<int>>>>;
+template<typename Scalar>
+using SparseLUStats = SparseLUStatsSolver<SparseLU<SparseMatrix<Scalar>, TimedOrdering<COLAMDOrdering<int>>>>;
+template<typename Scalar>
+using SparseQRStats = SparseQRStatsSolver<SparseQR<SparseMatrix<Scalar>, TimedOrdering<COLAMDOrdering<int>>>>;
+
+// ordering and symbolic analysis.
+template<typename Solver, typename MatrixType>
+static void sparse_analyze(Solver& solver, const MatrixType& matrix, SparseDirectStats& stats)
+{
+	sparse_ordering_seconds = 0.0;
+	const auto start = chrono::steady_clock::now();
+	solver.analyzePattern(matrix);
+	const double seconds = seconds_since(start);
+	stats.ordering = Solver::ordering;
+	stats.orderingSeconds = sparse_ordering_seconds;
+	stats.symbolicSeconds = std::max(0.0, seconds - sparse_ordering_seconds);
+}
+
+// numeric factorization, the factor sizes are only known when it succeeds.
+template<typename Solver, typename MatrixType>
+static bool sparse_factorize(Solver& solver, const MatrixType& matrix, SparseDirectStats& stats)
+{
+	const auto start = chrono::steady_clock::now();
+	solver.factorize(matrix);
+	stats.numericSeconds = seconds_since(start);
+	stats.info = solver.info();
+	stats.nnzL = stats.info == Success ? solver.nnzL() : 0;
+	stats.nnzU = stats.info == Success ? solver.nnzU() : 0;
+	stats.workspaceBytes = solver.workspaceBytes(matrix.nonZeros());
+	return stats.info == Success;
+}
+
+// A x = b with a sparse direct Solver built on SparseMatrix<Scalar>, returns the ComputationInfo
+// of the factorization; x is left untouched when it fails. stats may be null.
+template<typename Solver, typename Scalar>
+static int sparse_direct_solve(int row, int col, int nnz, int* outerIndex, int* innerIndex, Scalar* values,
+	const Scalar* inrhs, int size, Scalar* vout, SparseDirectStats* stats)
+{
+	Map<const SparseMatrix<Scalar>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<const DenseVector<Scalar>> rhs(inrhs, size);
+	Map<DenseVector<Scalar>> x(vout, size);
+
+	Solver solver;
+	SparseDirectStats local = {};
+	sparse_analyze(solver, matrix, local);
+	if (sparse_factorize(solver, matrix, local))
+	{
+		const auto start = chrono::steady_clock::now();
+		x = solver.solve(rhs);
+		local.solveSeconds = seconds_since(start);
+	}
+
+	if (stats != nullptr)
+		*stats = local;
+	return local.info;
+}
+
+EXPORT_API(bool) ssolve_conjugateGradient_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<ConjugateGradientOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+EXPORT_API(bool) ssolve_biCGSTAB_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<BiCGSTABOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+EXPORT_API(bool) ssolve_LeastSquaresConjugateGradient_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<LeastSquaresConjugateGradientOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+// compressed column storage of count (row, col, value) triplets, duplicates are summed.
+// innerIndex and valuesout must hold count entries; returns the number of non zeros.
+EXPORT_API(int) sfrom_triplets_(
+	int row,
+	int col,
+	int count,
+	_In_ int* rowIndices,
+	_In_ int* colIndices,
+	_In_ double* values,
+	_Out_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ double* valuesout) {
+	INSTRUMENT_EXPORT(row, col, count);
+
+	return sparse_from_triplets(row, col, count, rowIndices, colIndices, values, outerIndex, innerIndex, valuesout);
+}
+
+// symbolic phase of sadd_/sminus_ (and their single precision counterparts): the exact
+// column pointers of the result, returns its number of non zeros.
+EXPORT_API(int) sadd_symbolic_(
+	int row,
+	int col,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_Out_ int* outerIndex) {
+	INSTRUMENT_EXPORT(row, col, outerIndex1[col] + outerIndex2[col]);
+
+	return sparse_union_pattern(col, outerIndex1, innerIndex1, outerIndex2, innerIndex2, outerIndex);
+}
+
+// numeric phase of A + B into buffers sized by sadd_symbolic_.
+EXPORT_API(void) sadd_(
+	int row,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ double* values1,
+	 int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ double* values2,
+	_In_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	sparse_add(row, col, nnz1, outerIndex1, innerIndex1, values1, nnz2, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values);
+}
+
+// numeric phase of A - B into buffers sized by sadd_symbolic_.
+EXPORT_API(void) sminus_(
+	int row,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ double* values1,
+	int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ double* values2,
+	_In_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	sparse_minus(row, col, nnz1, outerIndex1, innerIndex1, values1, nnz2, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values);
+}
+
+// symbolic phase of the (row x inner) by (inner x col) product: the exact column pointers
+// of the result, returns its number of non zeros.
+EXPORT_API(int) smult_symbolic_(
+	int row,
+	int inner,
+	int col,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_Out_ int* outerIndex) {
+	INSTRUMENT_EXPORT(row, col, outerIndex1[inner] + outerIndex2[col]);
+
+	return sparse_product_pattern(row, col, outerIndex1, innerIndex1, outerIndex2, innerIndex2, outerIndex);
+}
+
+// numeric phase of the product into buffers sized by smult_symbolic_.
+EXPORT_API(void) smult_(
+	int row,
+	int inner,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ double* values1,
+	int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ double* values2,
+	_In_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	sparse_product_values(row, col, outerIndex1, innerIndex1, values1, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values);
+}
+
+// numeric phase of the product that also drops entries with magnitude <= dropTolerance.
+// outerIndex comes from smult_symbolic_ and is rewritten for the pruned result, innerIndex and
+// values must hold the symbolic number of non zeros; returns the number kept.
+EXPORT_API(int) smult_pruned_(
+	int row,
+	int inner,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ double* values1,
+	int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ double* values2,
+	double dropTolerance,
+	_Inout_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	return sparse_product_values(row, col, outerIndex1, innerIndex1, values1, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values, dropTolerance);
+}
+
+// sparse matrix product with vector.
+EXPORT_API(void) smultv_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values, 
+	_In_ double* v1, 
+	const int length, 
+	_Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	sparse_multv(row, col, nnz, outerIndex, innerIndex, values, v1, length, vout);
+}
+
+// sparse transpose.
+EXPORT_API(void) stranspose_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_Out_ int* outerIndexout,
+	_Out_ int* innerIndexout,
+	_Out_ double* valuesout)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	sparse_transpose(row, col, nnz, outerIndex, innerIndex, values, outerIndexout, innerIndexout, valuesout);
+}
+
+// A x = b, returns the ComputationInfo of the factorization and fills stats when it is not null.
+EXPORT_API(int) ssolve_simplicialLLT_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SimplicialLLTStats<double>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
+
+EXPORT_API(int) ssolve_simplicialLDLT_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SimplicialLDLTStats<double>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
+
+EXPORT_API(int) ssolve_sparseLU_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SparseLUStats<double>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
+
+EXPORT_API(int) ssolve_sparseQR_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SparseQRStats<double>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
+
+// unsupported!
+EXPORT_API(bool) ssolve_GMRES_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
 	_In_ int size,
+	_In_opt_ double* x0,
 	_Out_ double* vout,
-    _Out_ int* iterations,
-    _Out_ double* error){
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<GMRESOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+// unsupported!
+EXPORT_API(bool) ssolve_MINRES_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<MINRESOf, IdentityPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+// unsupported!
+EXPORT_API(bool) ssolve_DGMRES_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return iterative_solve<MINRESOf, IdentityPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
+
+EXPORT_API(void*) siterative_create_(int solverType, int preconditioner)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return iterative_solver_create(solverType, preconditioner);
+}
 
+// copies the matrix and builds the preconditioner, which is kept for every
+// following siterative_solve_ until the next compute.
+EXPORT_API(bool) siterative_compute_(
+	_In_ void* handle,
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	int fillFactor,
+	double dropTolerance,
+	double shift)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
 	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return static_cast<IterativeSolver*>(handle)->compute(matrix, fillFactor, dropTolerance, shift);
+}
+
+EXPORT_API(bool) siterative_solve_(
+	_In_ void* handle,
+	int maxIterations,
+	double tolerance,
+	_In_ double* inrhs,
+	_In_ int size,
+	_In_opt_ double* x0,
+	_Out_ double* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor)
+{
+	INSTRUMENT_EXPORT(size, 1, 0);
 	Map<const VectorXd> rhs(inrhs, size);
 	Map<VectorXd> x(vout, size);
+	return static_cast<IterativeSolver*>(handle)->solve(maxIterations, tolerance, rhs, x0, x, iterations, error, monitor);
+}
+
+EXPORT_API(void) siterative_destroy_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<IterativeSolver*>(handle);
+}
+
+EXPORT_API(bool) snormal_equations__leastsquares_sparselu_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout){
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<VectorXd> rhs(inrhs, row);
+	Map<VectorXd> result(vout, col);
+
+	SparseLU<SparseMatrix<double>> solver;
+	solver.compute((matrix.transpose() * matrix));
+	result = solver.solve(matrix.transpose() * rhs);
+
+	return solver.info() == Success;
+}
+
+EXPORT_API(double) snorm_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return sparse_norm(row, col, nnz, outerIndex, innerIndex, values);
+}
+
+EXPORT_API(double) ssquaredNorm_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return sparse_squared_norm(row, col, nnz, outerIndex, innerIndex, values);
+}
+
+EXPORT_API(double) srelative_error_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* v1,
+	_In_ double* v2) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<VectorXd> rhs(v1, row);
+	Map<VectorXd> x(v2, row);
+	return (matrix * x - rhs).norm() / rhs.norm();
+}
+
+EXPORT_API(double) sabsolute_error_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,	
+	_In_ double* v1,
+	_In_ double* v2) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<VectorXd> rhs(v1, row);
+	Map<VectorXd> x(v2, row);
+	return (matrix * x - rhs).norm();
+}
+
+
+// single precision sparse exports, same layouts as the s* exports. Tolerances
+// and the reported error stay double.
+EXPORT_API(int) sffrom_triplets_(
+	int row,
+	int col,
+	int count,
+	_In_ int* rowIndices,
+	_In_ int* colIndices,
+	_In_ float* values,
+	_Out_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ float* valuesout) {
+	INSTRUMENT_EXPORT(row, col, count);
+
+	return sparse_from_triplets(row, col, count, rowIndices, colIndices, values, outerIndex, innerIndex, valuesout);
+}
+
+EXPORT_API(void) sfadd_(
+	int row,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ float* values1,
+	int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ float* values2,
+	_In_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ float* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	sparse_add(row, col, nnz1, outerIndex1, innerIndex1, values1, nnz2, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values);
+}
+
+EXPORT_API(void) sfminus_(
+	int row,
+	int col,
+	int nnz1,
+	_In_ int* outerIndex1,
+	_In_ int* innerIndex1,
+	_In_ float* values1,
+	int nnz2,
+	_In_ int* outerIndex2,
+	_In_ int* innerIndex2,
+	_In_ float* values2,
+	_In_ int* outerIndex,
+	_Out_ int* innerIndex,
+	_Out_ float* values) {
+	INSTRUMENT_EXPORT(row, col, nnz1 + nnz2);
+
+	sparse_minus(row, col, nnz1, outerIndex1, innerIndex1, values1, nnz2, outerIndex2, innerIndex2, values2,
+		outerIndex, innerIndex, values);
+}
+
+EXPORT_API(void) sfmultv_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* v1,
+	const int length,
+	_Out_ float* vout)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	sparse_multv(row, col, nnz, outerIndex, innerIndex, values, v1, length, vout);
+}
+
+EXPORT_API(void) sftranspose_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_Out_ int* outerIndexout,
+	_Out_ int* innerIndexout,
+	_Out_ float* valuesout)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	sparse_transpose(row, col, nnz, outerIndex, innerIndex, values, outerIndexout, innerIndexout, valuesout);
+}
+
+EXPORT_API(float) sfnorm_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values) {
+	INSTRUMENT_EXPORT(row, col, nnz);
+
+	return sparse_norm(row, col, nnz, outerIndex, innerIndex, values);
+}
+
+EXPORT_API(float) sfsquaredNorm_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	ConjugateGradient<SparseMatrix<double>> solver;
+	return sparse_squared_norm(row, col, nnz, outerIndex, innerIndex, values);
+}
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
-	}
-	
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
-	}
+EXPORT_API(int) sfsolve_simplicialLLT_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_Out_ float* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SimplicialLLTStats<float>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+EXPORT_API(int) sfsolve_simplicialLDLT_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_Out_ float* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SimplicialLDLTStats<float>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+EXPORT_API(int) sfsolve_sparseLU_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_Out_ float* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SparseLUStats<float>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
+}
 
-    return solver.info() == Success;
+EXPORT_API(int) sfsolve_sparseQR_(
+	int row,
+	int col,
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_Out_ float* vout,
+	_Out_opt_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	return sparse_direct_solve<SparseQRStats<float>>(row, col, nnz, outerIndex, innerIndex, values, inrhs, size, vout, stats);
 }
 
-EXPORT_API(bool) ssolve_biCGSTAB_(
+EXPORT_API(bool) sfsolve_conjugateGradient_(
 	int row,
 	int col,
 	int nnz,
 	int maxIterations,
 	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
+	_In_ float* values,
+	_In_ float* inrhs,
 	_In_ int size,
-	_Out_ double* vout,
+	_In_opt_ float* x0,
+	_Out_ float* vout,
 	_Out_ int* iterations,
-	_Out_ double* error) {
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	return iterative_solve<ConjugateGradientOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
 
-	BiCGSTAB<SparseMatrix<double>> solver;
+EXPORT_API(bool) sfsolve_biCGSTAB_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_In_opt_ float* x0,
+	_Out_ float* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
-	}
+	return iterative_solve<BiCGSTABOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
 
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
-	}
+EXPORT_API(bool) sfsolve_LeastSquaresConjugateGradient_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_In_opt_ float* x0,
+	_Out_ float* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	return iterative_solve<LeastSquaresConjugateGradientOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+EXPORT_API(bool) sfsolve_GMRES_(
+	int row,
+	int col,
+	int nnz,
+	int maxIterations,
+	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ float* values,
+	_In_ float* inrhs,
+	_In_ int size,
+	_In_opt_ float* x0,
+	_Out_ float* vout,
+	_Out_ int* iterations,
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	return solver.info() == Success;
+	return iterative_solve<GMRESOf, DiagonalPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
 }
 
-EXPORT_API(bool) ssolve_LeastSquaresConjugateGradient_(
+EXPORT_API(bool) sfsolve_MINRES_(
 	int row,
 	int col,
 	int nnz,
 	int maxIterations,
 	double tolerance,
+	int preconditioner,
+	int fillFactor,
+	double dropTolerance,
+	double shift,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
+	_In_ float* values,
+	_In_ float* inrhs,
 	_In_ int size,
-	_Out_ double* vout,
+	_In_opt_ float* x0,
+	_Out_ float* vout,
 	_Out_ int* iterations,
-	_Out_ double* error) {
-
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	_Out_ double* error,
+	_Inout_opt_ IterativeMonitor* monitor) {
+	INSTRUMENT_EXPORT(row, col, nnz);
 
-	LeastSquaresConjugateGradient<SparseMatrix<double>> solver;
+	return iterative_solve<MINRESOf, IdentityPreconditioning>(row, col, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift,
+		outerIndex, innerIndex, values, inrhs, size, x0, vout, iterations, error, monitor);
+}
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
+// Sparse direct solver kept alive between calls, so that a matrix can be solved
+// many times and refactorized with new values without repeating the ordering
+// and the symbolic analysis.
+class SparseFactorization
+{
+public:
+	virtual ~SparseFactorization() {}
+	virtual void analyzePattern(const SparseMatrix<double>& matrix) = 0;
+	virtual bool factorize(const SparseMatrix<double>& matrix) = 0;
+	virtual bool solve(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) = 0;
+
+	// phases of the last analyzePattern, factorize and solve.
+	SparseDirectStats stats = {};
+};
+
+template<typename Solver>
+class SparseFactorizationImpl : public SparseFactorization
+{
+public:
+	void analyzePattern(const SparseMatrix<double>& matrix) override
+	{
+		sparse_analyze(solver, matrix, stats);
 	}
 
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
+	bool factorize(const SparseMatrix<double>& matrix) override
+	{
+		return sparse_factorize(solver, matrix, stats);
 	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	bool solve(const Map<const MatrixXd>& rhs, Map<MatrixXd>& x) override
+	{
+		const auto start = chrono::steady_clock::now();
+		x = solver.solve(rhs);
+		stats.solveSeconds = seconds_since(start);
+		return solver.info() == Success;
+	}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+private:
+	Solver solver;
+};
 
-	return solver.info() == Success;
+// must match EigenCore.Core.Sparse.LinearAlgebra.DirectSolverType.
+enum DirectSolverType
+{
+	SimplicialLLTSolver = 0,
+	SimplicialLDLTSolver = 1,
+	SparseLUSolver = 2,
+	SparseQRSolver = 3,
+	MixedPrecisionSparseLUSolver = 4,
+	MixedPrecisionSimplicialLDLTSolver = 5
+};
+
+EXPORT_API(void*) sfactorization_create_(int solverType)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	// kept factorizations are double, mixed precision types use their double counterpart.
+	switch (solverType)
+	{
+	case SimplicialLLTSolver:
+		return new SparseFactorizationImpl<SimplicialLLTStats<double>>();
+	case SimplicialLDLTSolver:
+	case MixedPrecisionSimplicialLDLTSolver:
+		return new SparseFactorizationImpl<SimplicialLDLTStats<double>>();
+	case SparseQRSolver:
+		return new SparseFactorizationImpl<SparseQRStats<double>>();
+	case SparseLUSolver:
+	default:
+		return new SparseFactorizationImpl<SparseLUStats<double>>();
+	}
 }
 
-EXPORT_API(void) sadd_(
+// ordering and symbolic factorization, only depends on the sparsity pattern.
+EXPORT_API(void) sfactorization_analyzePattern_(
+	_In_ void* handle,
 	int row,
 	int col,
-	int nnz1,
-	_In_ int* outerIndex1,
-	_In_ int* innerIndex1,
-	_In_ double* values1,
-	 int nnz2,
-	_In_ int* outerIndex2,
-	_In_ int* innerIndex2,
-	_In_ double* values2,
-	_Out_ int* nnz,
-	_Out_ int* outerIndex,
-	_Out_ int* innerIndex,
-	_Out_ double* values) {
-
-	Map<SparseMatrix<double>>  matrix1(row, col, nnz1, outerIndex1, innerIndex1, values1);
-	Map<SparseMatrix<double>>  matrix2(row, col, nnz2, outerIndex2, innerIndex2, values2);
-	SparseMatrix<double> resultTmp = matrix1 + matrix2;
-	*nnz = (int)resultTmp.nonZeros();
-	resultTmp.makeCompressed();
-
-	copy(resultTmp.outerIndexPtr(), resultTmp.outerIndexPtr() + (col + 1), outerIndex);
-	copy(resultTmp.innerIndexPtr(), resultTmp.innerIndexPtr() + *nnz, innerIndex);
-	copy(resultTmp.valuePtr(), resultTmp.valuePtr() + *nnz, values);
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	static_cast<SparseFactorization*>(handle)->analyzePattern(matrix);
 }
 
-EXPORT_API(void) sminus_(
+// numeric factorization, the pattern must match the one given to sfactorization_analyzePattern_.
+EXPORT_API(bool) sfactorization_factorize_(
+	_In_ void* handle,
 	int row,
 	int col,
-	int nnz1,
-	_In_ int* outerIndex1,
-	_In_ int* innerIndex1,
-	_In_ double* values1,
-	int nnz2,
-	_In_ int* outerIndex2,
-	_In_ int* innerIndex2,
-	_In_ double* values2,
-	_Out_ int* nnz,
-	_Out_ int* outerIndex,
-	_Out_ int* innerIndex,
-	_Out_ double* values) {
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return static_cast<SparseFactorization*>(handle)->factorize(matrix);
+}
+
+EXPORT_API(bool) sfactorization_solve_(
+	_In_ void* handle,
+	_In_ double* inrhs,
+	int rhsSize,
+	_Out_ double* vout,
+	int size)
+{
+	INSTRUMENT_EXPORT(rhsSize, 1, 0);
+	Map<const MatrixXd> rhs(inrhs, rhsSize, 1);
+	Map<MatrixXd> x(vout, size, 1);
+	return static_cast<SparseFactorization*>(handle)->solve(rhs, x);
+}
 
-	Map<SparseMatrix<double>>  matrix1(row, col, nnz1, outerIndex1, innerIndex1, values1);
-	Map<SparseMatrix<double>>  matrix2(row, col, nnz2, outerIndex2, innerIndex2, values2);
-	SparseMatrix<double> resultTmp = matrix1 - matrix2;
-	*nnz = (int)resultTmp.nonZeros();
-	resultTmp.makeCompressed();
+// A X = B for a column-major rhsSize x rhsCols block of right-hand sides.
+EXPORT_API(bool) sfactorization_solveBlock_(
+	_In_ void* handle,
+	_In_ double* b,
+	int rhsSize,
+	int rhsCols,
+	_Out_ double* vout,
+	int size)
+{
+	INSTRUMENT_EXPORT(rhsSize, rhsCols, 0);
+	Map<const MatrixXd> rhs(b, rhsSize, rhsCols);
+	Map<MatrixXd> x(vout, size, rhsCols);
+	return static_cast<SparseFactorization*>(handle)->solve(rhs, x);
+}
 
-	copy(resultTmp.outerIndexPtr(), resultTmp.outerIndexPtr() + (col + 1), outerIndex);
-	copy(resultTmp.innerIndexPtr(), resultTmp.innerIndexPtr() + *nnz, innerIndex);
-	copy(resultTmp.valuePtr(), resultTmp.valuePtr() + *nnz, values);
+// ordering and symbolic time of the last analyzePattern, numeric time and fill-in of the last factorize, time of the last solve.
+EXPORT_API(void) sfactorization_stats_(_In_ void* handle, _Out_ SparseDirectStats* stats)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	*stats = static_cast<SparseFactorization*>(handle)->stats;
 }
 
-EXPORT_API(void) smult_(
+EXPORT_API(void) sfactorization_destroy_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<SparseFactorization*>(handle);
+}
+
+// A X = B with a single factorization for all the columns of B.
+EXPORT_API(bool) ssolve_block_(
+	int solverType,
 	int row,
 	int col,
-	int nnz1,
-	_In_ int* outerIndex1,
-	_In_ int* innerIndex1,
-	_In_ double* values1,
-	int nnz2,
-	_In_ int* outerIndex2,
-	_In_ int* innerIndex2,
-	_In_ double* values2,
-	_Out_ int* nnz,
-	_Out_ int* outerIndex,
-	_Out_ int* innerIndex,
-	_Out_ double* values) {
+	int nnz,
+	_In_ int* outerIndex,
+	_In_ int* innerIndex,
+	_In_ double* values,
+	_In_ double* b,
+	int rhsCols,
+	_Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<const MatrixXd> rhs(b, row, rhsCols);
+	Map<MatrixXd> x(vout, col, rhsCols);
 
-	Map<SparseMatrix<double>>  matrix1(row, col, nnz1, outerIndex1, innerIndex1, values1);
-	Map<SparseMatrix<double>>  matrix2(row, col, nnz2, outerIndex2, innerIndex2, values2);
-	SparseMatrix<double> resultTmp = matrix1 * matrix2;
-	*nnz = (int)resultTmp.nonZeros();
-	resultTmp.makeCompressed();
+	unique_ptr<SparseFactorization> factorization(static_cast<SparseFactorization*>(sfactorization_create_(solverType)));
+	factorization->analyzePattern(matrix);
+	return factorization->factorize(matrix) && factorization->solve(rhs, x);
+}
+
+// A x = b factorized in float (SparseLU or SimplicialLDLT) and refined in double,
+// see iterative_refinement. Falls back to the double factorization when refinement
+// stalls; returns false in that case.
+template<typename LowSolver, typename HighSolver>
+static bool sparse_mixed_precision_solve(const Map<const SparseMatrix<double>>& matrix,
+	const Map<const VectorXd>& rhs, Map<VectorXd>& x, int* steps)
+{
+	*steps = 0;
+	double matrixNorm = (matrix.cwiseAbs() * VectorXd::Ones(matrix.cols())).maxCoeff();
+	SparseMatrix<float> lowMatrix = matrix.cast<float>();
+
+	LowSolver low;
+	low.compute(lowMatrix);
+	if (low.info() == Success && iterative_refinement(low, matrix, matrixNorm, rhs, x, steps)) {
+		return true;
+	}
 
-	copy(resultTmp.outerIndexPtr(), resultTmp.outerIndexPtr() + (col + 1), outerIndex);
-	copy(resultTmp.innerIndexPtr(), resultTmp.innerIndexPtr() + *nnz, innerIndex);
-	copy(resultTmp.valuePtr(), resultTmp.valuePtr() + *nnz, values);
+	HighSolver high;
+	high.compute(matrix);
+	x = high.solve(rhs);
+	return false;
 }
 
-// sparse matrix product with vector.
-EXPORT_API(void) smultv_(
+EXPORT_API(bool) ssolve_mixedPrecision_(
+	int solverType,
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values, 
-	_In_ double* v1, 
-	const int length, 
-	_Out_ double* vout)
+	_In_ double* values,
+	_In_ double* inrhs,
+	_In_ int size,
+	_Out_ double* vout,
+	_Out_ int* steps)
 {
-	Map<SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> vector(v1, length);
-	Map<VectorXd> result(vout, row);
-	result = matrix * vector;
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	Map<const VectorXd> rhs(inrhs, size);
+	Map<VectorXd> x(vout, col);
+
+	if (solverType == SimplicialLDLTSolver || solverType == MixedPrecisionSimplicialLDLTSolver) {
+		return sparse_mixed_precision_solve<SimplicialLDLT<SparseMatrix<float>>, SimplicialLDLT<SparseMatrix<double>>>(matrix, rhs, x, steps);
+	}
+
+	return sparse_mixed_precision_solve<SparseLU<SparseMatrix<float>>, SparseLU<SparseMatrix<double>>>(matrix, rhs, x, steps);
 }
 
-// sparse transpose.
-EXPORT_API(void) stranspose_(
+// Sparse matrix-vector product kept alive between calls. The matrix is copied once into
+// row-major (CSR) storage so every entry of y is an independent row dot product; rows are
+// split into contiguous ranges of about the same number of nonzeros, one per thread, and
+// each thread writes its own range of y, so no atomics or per-thread buffers are needed.
+class SparseMatrixVectorProduct
+{
+public:
+	template<typename SparseMatrixType>
+	explicit SparseMatrixVectorProduct(const SparseMatrixType& other) : matrix(other)
+	{
+		matrix.makeCompressed();
+	}
+
+	void multiply(const double* v, double* vout) const
+	{
+		const int rows = static_cast<int>(matrix.rows());
+#ifdef EIGEN_HAS_OPENMP
+		const int threads = effective_num_threads();
+		// same threshold Eigen uses for its own row-major sparse * dense product.
+		if (threads > 1 && matrix.nonZeros() > 20000)
+		{
+			#pragma omp parallel num_threads(threads)
+			{
+				const int part = omp_get_thread_num();
+				const int parts = omp_get_num_threads();
+				multiply_rows(first_row(part, parts), first_row(part + 1, parts), v, vout);
+			}
+			return;
+		}
+#endif
+		multiply_rows(0, rows, v, vout);
+	}
+
+	Index rows() const { return matrix.rows(); }
+	Index cols() const { return matrix.cols(); }
+	Index nonZeros() const { return matrix.nonZeros(); }
+
+private:
+	// first row of the given part, balancing nonzeros plus one unit of work per row.
+	int first_row(int part, int parts) const
+	{
+		const int rows = static_cast<int>(matrix.rows());
+		if (part >= parts)
+			return rows;
+
+		const int* outer = matrix.outerIndexPtr();
+		const long long target = (static_cast<long long>(matrix.nonZeros()) + rows) * part / parts;
+		int low = 0;
+		int high = rows;
+		while (low < high)
+		{
+			const int middle = low + (high - low) / 2;
+			if (static_cast<long long>(outer[middle]) + middle < target)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		return low;
+	}
+
+	void multiply_rows(int begin, int end, const double* v, double* vout) const
+	{
+		const int* outer = matrix.outerIndexPtr();
+		const int* inner = matrix.innerIndexPtr();
+		const double* values = matrix.valuePtr();
+		for (int i = begin; i < end; ++i)
+		{
+			double sum = 0.0;
+			for (int k = outer[i]; k < outer[i + 1]; ++k)
+				sum += values[k] * v[inner[k]];
+			vout[i] = sum;
+		}
+	}
+
+	SparseMatrix<double, RowMajor> matrix;
+};
+
+// caches a CSR copy of a column-major (CSC) sparse matrix for repeated products.
+EXPORT_API(void*) smultv_create_(
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,
-	_Out_ int* outerIndexout,
-	_Out_ int* innerIndexout,
-	_Out_ double* valuesout)
+	_In_ double* values)
 {
-	Map<SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	SparseMatrix<double> result = matrix.transpose();
-	copy(result.outerIndexPtr(), result.outerIndexPtr() + (row + 1), outerIndexout);
-	copy(result.innerIndexPtr(), result.innerIndexPtr() + nnz, innerIndexout);
-	copy(result.valuePtr(), result.valuePtr() + nnz, valuesout);
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return new SparseMatrixVectorProduct(matrix);
 }
 
-EXPORT_API(void) ssolve_simplicialLLT_(
+// same as smultv_create_ for a matrix already in row-major (CSR) storage.
+EXPORT_API(void*) smultv_createRowMajor_(
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout) {
+	_In_ double* values)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	Map<const SparseMatrix<double, RowMajor>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+	return new SparseMatrixVectorProduct(matrix);
+}
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+// vout = A * v1, runs on the thread budget of the calling thread.
+EXPORT_API(void) smultv_multiply_(_In_ void* handle, _In_ double* v1, _Out_ double* vout)
+{
+	INSTRUMENT_EXPORT(static_cast<SparseMatrixVectorProduct*>(handle)->rows(), static_cast<SparseMatrixVectorProduct*>(handle)->cols(), static_cast<SparseMatrixVectorProduct*>(handle)->nonZeros());
+	static_cast<SparseMatrixVectorProduct*>(handle)->multiply(v1, vout);
+}
+
+EXPORT_API(void) smultv_destroy_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<SparseMatrixVectorProduct*>(handle);
+}
+
+// Partial eigensolver: k eigenpairs of a square sparse matrix by Krylov-Schur restarted Arnoldi
+// (Stewart, 2001) with full reorthogonalization. A symmetric matrix runs it in real arithmetic,
+// where the Schur form of the projected matrix is diagonal and Krylov-Schur is thick-restart
+// Lanczos, equivalent to implicitly restarted Lanczos. A general matrix runs it in complex
+// arithmetic, so the Schur form is triangular and its diagonal can be reordered by plane
+// rotations. Shift-invert applies (A - sigma I)^-1 through one sparse factorization that
+// serves every restart.
+
+// must match EigenCore.Core.Sparse.LinearAlgebra.EigenvalueSelection.
+enum EigenvalueSelection
+{
+	LargestEigenvalues = 0,
+	SmallestEigenvalues = 1,
+	NearestSigmaEigenvalues = 2
+};
+
+// A, or (A - sigma I)^-1 when shift-inverted: LDLT for a symmetric matrix, SparseLU
+// otherwise or when LDLT meets a zero pivot.
+class EigsOperator
+{
+public:
+	bool compute(const Map<const SparseMatrix<double>>& matrix, bool symmetric, bool shiftInvert, double sigma)
+	{
+		if (!shiftInvert) {
+			product.reset(new SparseMatrixVectorProduct(matrix));
+			return true;
+		}
+
+		SparseMatrix<double> identity(matrix.rows(), matrix.cols());
+		identity.setIdentity();
+		const SparseMatrix<double> shifted = matrix - sigma * identity;
+		if (symmetric) {
+			factorization.reset(new SparseFactorizationImpl<SimplicialLDLTStats<double>>());
+			factorization->analyzePattern(shifted);
+			if (factorization->factorize(shifted)) {
+				return true;
+			}
+		}
+
+		factorization.reset(new SparseFactorizationImpl<SparseLUStats<double>>());
+		factorization->analyzePattern(shifted);
+		return factorization->factorize(shifted);
+	}
+
+	void apply(const Ref<const VectorXd>& x, Ref<VectorXd> y) const
+	{
+		if (product) {
+			product->multiply(x.data(), y.data());
+			return;
+		}
+
+		Map<const MatrixXd> rhs(x.data(), x.size(), 1);
+		Map<MatrixXd> result(y.data(), y.size(), 1);
+		factorization->solve(rhs, result);
+	}
+
+	// real and imaginary parts as two columns.
+	void apply(const Ref<const VectorXcd>& x, Ref<VectorXcd> y) const
+	{
+		MatrixXd parts(x.size(), 2);
+		parts.col(0) = x.real();
+		parts.col(1) = x.imag();
+		MatrixXd result(x.size(), 2);
+		if (product) {
+			product->multiply(parts.col(0).data(), result.col(0).data());
+			product->multiply(parts.col(1).data(), result.col(1).data());
+		}
+		else {
+			Map<const MatrixXd> rhs(parts.data(), parts.rows(), 2);
+			Map<MatrixXd> out(result.data(), result.rows(), 2);
+			factorization->solve(rhs, out);
+		}
+
+		y.real() = result.col(0);
+		y.imag() = result.col(1);
+	}
+
+private:
+	unique_ptr<SparseMatrixVectorProduct> product;
+	unique_ptr<SparseFactorization> factorization;
+};
+
+// Ritz values of the operator in order of preference: shift-invert maps the eigenvalues
+// nearest sigma to the largest in magnitude; otherwise the largest or smallest, by real part
+// for a general matrix.
+static double eigs_priority(const complex<double>& theta, int which, bool shiftInvert)
+{
+	if (shiftInvert) {
+		return abs(theta);
+	}
+
+	return which == SmallestEigenvalues ? -theta.real() : theta.real();
+}
+
+// deterministic start and breakdown vectors, see splitmix_uniform.
+template<typename VectorType>
+static void eigs_random_vector(VectorType& v, uint64_t& state)
+{
+	for (Index i = 0; i < v.size(); ++i)
+		v(i) = splitmix_uniform(state);
+}
+
+// classical Gram-Schmidt against the first count columns of V, applied twice (DGKS);
+// h receives the coefficients, returns the norm of w before orthogonalization.
+template<typename MatrixType, typename VectorType>
+static double eigs_orthogonalize(const MatrixType& V, int count, VectorType& w, VectorType& h)
+{
+	const double norm = w.norm();
+	h = V.leftCols(count).adjoint() * w;
+	w.noalias() -= V.leftCols(count) * h;
+	VectorType correction = V.leftCols(count).adjoint() * w;
+	w.noalias() -= V.leftCols(count) * correction;
+	h += correction;
+	return norm;
+}
+
+// H = Q T Q^T with T diagonal in order of preference.
+static void eigs_schur(const MatrixXd& H, int which, bool shiftInvert, MatrixXd& T, MatrixXd& Q)
+{
+	const int m = static_cast<int>(H.rows());
+	SelfAdjointEigenSolver<MatrixXd> solver(0.5 * (H + H.transpose()));
+	vector<int> order(m);
+	iota(order.begin(), order.end(), 0);
+	stable_sort(order.begin(), order.end(), [&](int a, int b) {
+		return eigs_priority(solver.eigenvalues()(a), which, shiftInvert) > eigs_priority(solver.eigenvalues()(b), which, shiftInvert);
+	});
+
+	T = MatrixXd::Zero(m, m);
+	Q.resize(m, m);
+	for (int i = 0; i < m; ++i) {
+		T(i, i) = solver.eigenvalues()(order[i]);
+		Q.col(i) = solver.eigenvectors().col(order[i]);
+	}
+}
+
+// H = Q T Q^* with T upper triangular, its diagonal reordered by swapping neighbours: the
+// rotation whose first column is the eigenvector of the second entry exchanges the two.
+static void eigs_schur(const MatrixXcd& H, int which, bool shiftInvert, MatrixXcd& T, MatrixXcd& Q)
+{
+	const int m = static_cast<int>(H.rows());
+	ComplexSchur<MatrixXcd> schur(H);
+	T = schur.matrixT();
+	Q = schur.matrixU();
+	for (int i = 0; i < m; ++i) {
+		int best = i;
+		for (int j = i + 1; j < m; ++j) {
+			if (eigs_priority(T(j, j), which, shiftInvert) > eigs_priority(T(best, best), which, shiftInvert))
+				best = j;
+		}
+
+		for (int j = best; j > i; --j) {
+			JacobiRotation<complex<double>> rotation;
+			rotation.makeGivens(T(j - 1, j), T(j, j) - T(j - 1, j - 1));
+			T.applyOnTheLeft(j - 1, j, rotation.adjoint());
+			T.applyOnTheRight(j - 1, j, rotation);
+			Q.applyOnTheRight(j - 1, j, rotation);
+			T(j, j - 1) = 0;
+		}
+	}
+}
+
+// unit eigenvector of T for its i-th diagonal entry, supported on the first i + 1 entries.
+static VectorXd eigs_schur_vector(const MatrixXd&, int i)
+{
+	return VectorXd::Unit(i + 1, i);
+}
 
-	SimplicialLLT<SparseMatrix<double>> solver;
+static VectorXcd eigs_schur_vector(const MatrixXcd& T, int i)
+{
+	const double smallest = max(numeric_limits<double>::epsilon() * T.norm(), numeric_limits<double>::min());
+	VectorXcd s = VectorXcd::Zero(i + 1);
+	s(i) = 1;
+	for (int l = i - 1; l >= 0; --l) {
+		complex<double> pivot = T(l, l) - T(i, i);
+		if (abs(pivot) < smallest)
+			pivot = smallest;
+		s(l) = -(T.block(l, l + 1, 1, i - l) * s.segment(l + 1, i - l))(0) / pivot;
+	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	return s.normalized();
+}
+
+// Krylov-Schur on m + 1 basis vectors keeping p = (m + k) / 2 Schur vectors at each restart,
+// theta receives the k leading Ritz values of the operator and vectors their unit Ritz vectors.
+template<typename Scalar>
+static int krylov_schur(const EigsOperator& op, int n, int k, int m, int maxRestarts, double tolerance,
+	int which, bool shiftInvert, VectorXcd& theta, MatrixXcd& vectors, int* restarts, int* converged)
+{
+	typedef Matrix<Scalar, Dynamic, Dynamic> MatrixType;
+	typedef Matrix<Scalar, Dynamic, 1> VectorType;
+	const double eps = numeric_limits<double>::epsilon();
+
+	MatrixType V(n, m + 1);
+	MatrixType H = MatrixType::Zero(m + 1, m);
+	MatrixType T, Q;
+	VectorType w(n), h;
+	uint64_t state = 0;
+
+	eigs_random_vector(w, state);
+	V.col(0) = w.normalized();
+	int p = 0;
+	for (int restart = 0;; ++restart) {
+		for (int j = p; j < m; ++j) {
+			op.apply(V.col(j), w);
+			const double norm = eigs_orthogonalize(V, j + 1, w, h);
+			H.col(j).head(j + 1) = h;
+			const double beta = w.norm();
+			if (beta > eps * norm) {
+				H(j + 1, j) = beta;
+				V.col(j + 1) = w / beta;
+				continue;
+			}
+
+			// invariant subspace: continue with a vector orthogonal to it.
+			H(j + 1, j) = 0;
+			V.col(j + 1).setZero();
+			if (j + 1 < n) {
+				eigs_random_vector(w, state);
+				eigs_orthogonalize(V, j + 1, w, h);
+				V.col(j + 1) = w.normalized();
+			}
+		}
+
+		eigs_schur(MatrixType(H.topRows(m)), which, shiftInvert, T, Q);
+		const Scalar beta = H(m, m - 1);
+		int done = 0;
+		for (int i = 0; i < k; ++i) {
+			const double residual = abs(beta * (Q.block(m - 1, 0, 1, i + 1) * eigs_schur_vector(T, i))(0));
+			if (residual <= tolerance * max(abs(T(i, i)), pow(eps, 2.0 / 3.0)))
+				++done;
+		}
+
+		*converged = done;
+		*restarts = restart;
+		if (done == k || restart >= maxRestarts) {
+			theta.resize(k);
+			vectors.resize(n, k);
+			for (int i = 0; i < k; ++i) {
+				VectorType x = V.leftCols(m) * (Q.leftCols(i + 1) * eigs_schur_vector(T, i));
+				theta(i) = T(i, i);
+				vectors.col(i) = x.normalized().template cast<complex<double>>();
+			}
+
+			return done == k ? Success : NoConvergence;
+		}
+
+		p = min((m + k) / 2, m - 1);
+		V.leftCols(p) = V.leftCols(m) * Q.leftCols(p);
+		V.col(p) = V.col(m);
+		H.setZero();
+		H.topLeftCorner(p, p) = T.topLeftCorner(p, p);
+		H.row(p).head(p) = beta * Q.row(m - 1).head(p);
+	}
 }
 
-EXPORT_API(void) ssolve_simplicialLDLT_(
+// k eigenpairs of a square sparse matrix chosen by which (EigenvalueSelection), sigma is the
+// shift of NearestSigmaEigenvalues. subspace <= 0 uses max(2k + 1, 20) Krylov vectors,
+// maxRestarts <= 0 allows 1000 restarts and tolerance <= 0 asks for a Ritz residual of 1e-10
+// relative to the Ritz value. values and the unit vectors (n x k, column-major) are written in
+// order of selection, even without convergence; symmetric matrices have real eigenpairs.
+// Returns a ComputationInfo, NumericalIssue when A - sigma I is singular.
+EXPORT_API(int) seigs_(
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
 	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout){
+	int k,
+	int which,
+	double sigma,
+	int subspace,
+	int maxRestarts,
+	double tolerance,
+	_Out_ double* realValues,
+	_Out_ double* imagValues,
+	_Out_ double* realVectors,
+	_Out_ double* imagVectors,
+	_Out_ int* symmetric,
+	_Out_ int* restarts,
+	_Out_ int* converged)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	apply_thread_budget();
+	*symmetric = 0;
+	*restarts = 0;
+	*converged = 0;
+	if (row != col || k < 1 || k > row) {
+		return InvalidInput;
+	}
 
 	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	const SparseMatrix<double> transposed = matrix.transpose();
+	const bool isSymmetric = (matrix - transposed).norm() <= 1e-14 * matrix.norm();
+	const bool shiftInvert = which == NearestSigmaEigenvalues;
+	EigsOperator op;
+	if (!op.compute(matrix, isSymmetric, shiftInvert, sigma)) {
+		return NumericalIssue;
+	}
 
-	SimplicialLDLT<SparseMatrix<double>> solver;
+	const int m = min(row, max(subspace > 0 ? subspace : max(2 * k + 1, 20), k + 1));
+	maxRestarts = maxRestarts > 0 ? maxRestarts : 1000;
+	tolerance = tolerance > 0 ? tolerance : 1e-10;
+	VectorXcd theta;
+	MatrixXcd vectors;
+	const int info = isSymmetric
+		? krylov_schur<double>(op, row, k, m, maxRestarts, tolerance, which, shiftInvert, theta, vectors, restarts, converged)
+		: krylov_schur<complex<double>>(op, row, k, m, maxRestarts, tolerance, which, shiftInvert, theta, vectors, restarts, converged);
+
+	// eigenvalues of A, eigenvectors with their largest entry real and positive.
+	for (int i = 0; i < k; ++i) {
+		const complex<double> lambda = shiftInvert ? sigma + 1.0 / theta(i) : theta(i);
+		realValues[i] = lambda.real();
+		imagValues[i] = lambda.imag();
+
+		Index largest;
+		vectors.col(i).cwiseAbs().maxCoeff(&largest);
+		vectors.col(i) *= conj(vectors(largest, i)) / abs(vectors(largest, i));
+	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	Map<MatrixXd>(realVectors, row, k) = vectors.real();
+	Map<MatrixXd>(imagVectors, row, k) = vectors.imag();
+	*symmetric = isSymmetric ? 1 : 0;
+	return info;
 }
 
-EXPORT_API(void) ssolve_sparseLU_(
-	int row,
-	int col,
-	int nnz,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout) {
+// A * x and A^T * y straight from the caller's CSC arrays, so a sparse SVD never forms A^T or
+// A^T A. The columns are split into parts of balanced work; A^T * y writes each part's entries
+// directly, A * x scatters each part into its own column of partial and sums the columns.
+class BidiagonalizationOperator
+{
+public:
+	BidiagonalizationOperator(int rows, int cols, const int* outerIndex, const int* innerIndex, const double* values)
+		: rows(rows), cols(cols), outer(outerIndex), inner(innerIndex), values(values)
+	{
+		int parts = 1;
+#ifdef EIGEN_HAS_OPENMP
+		// same threshold Eigen uses for its own row-major sparse * dense product.
+		if (outer[cols] > 20000)
+			parts = max(1, min(effective_num_threads(), cols));
+#endif
+		starts.assign(parts + 1, cols);
+		starts[0] = 0;
+		for (int part = 1; part < parts; ++part)
+			starts[part] = first_col(part, parts);
+		if (parts > 1)
+			partial.resize(rows, parts);
+	}
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	void multiply(const Ref<const VectorXd>& x, Ref<VectorXd> y)
+	{
+		const int parts = static_cast<int>(starts.size()) - 1;
+		if (parts == 1) {
+			y.setZero();
+			scatter(0, x, y.data());
+			return;
+		}
+
+#ifdef EIGEN_HAS_OPENMP
+		#pragma omp parallel for num_threads(parts) schedule(static, 1)
+		for (int part = 0; part < parts; ++part) {
+			partial.col(part).setZero();
+			scatter(part, x, partial.col(part).data());
+		}
+
+		#pragma omp parallel for num_threads(parts) schedule(static)
+		for (int i = 0; i < rows; ++i)
+			y(i) = partial.row(i).sum();
+#endif
+	}
 
-	SparseLU<SparseMatrix<double>> solver;
+	void multiply_transpose(const Ref<const VectorXd>& y, Ref<VectorXd> x) const
+	{
+		const int parts = static_cast<int>(starts.size()) - 1;
+#ifdef EIGEN_HAS_OPENMP
+		#pragma omp parallel for num_threads(parts) schedule(static, 1) if(parts > 1)
+#endif
+		for (int part = 0; part < parts; ++part) {
+			for (int j = starts[part]; j < starts[part + 1]; ++j) {
+				double sum = 0;
+				for (int k = outer[j]; k < outer[j + 1]; ++k)
+					sum += values[k] * y(inner[k]);
+				x(j) = sum;
+			}
+		}
+	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+private:
+	// first column of the given part, balancing nonzeros plus one unit of work per column.
+	int first_col(int part, int parts) const
+	{
+		const long long target = (static_cast<long long>(outer[cols]) + cols) * part / parts;
+		int low = 0;
+		int high = cols;
+		while (low < high)
+		{
+			const int middle = low + (high - low) / 2;
+			if (static_cast<long long>(outer[middle]) + middle < target)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		return low;
+	}
+
+	void scatter(int part, const Ref<const VectorXd>& x, double* out) const
+	{
+		for (int j = starts[part]; j < starts[part + 1]; ++j) {
+			const double xj = x(j);
+			for (int k = outer[j]; k < outer[j + 1]; ++k)
+				out[inner[k]] += values[k] * xj;
+		}
+	}
+
+	int rows;
+	int cols;
+	const int* outer;
+	const int* inner;
+	const double* values;
+	vector<int> starts;
+	MatrixXd partial;
+};
+
+// thick-restart Golub-Kahan-Lanczos bidiagonalization (Baglama and Reichel) on m + 1 right and
+// m left vectors, both fully reorthogonalized:
+//   A V = U B,  A^T U = V B^T + beta v_m e_m^T,  B upper triangular.
+// Each restart keeps the p = (m + k) / 2 leading Ritz triplets from the SVD of B, which leaves B
+// diagonal with their couplings to v_m in column p; the residual of triplet i is |beta P(m-1, i)|.
+static int lanczos_bidiagonalization(BidiagonalizationOperator& op, int rows, int cols, int k, int m, int maxRestarts, double tolerance,
+	MatrixXd& leftVectors, VectorXd& singularValues, MatrixXd& rightVectors, int* restarts, int* converged)
+{
+	const double eps = numeric_limits<double>::epsilon();
+	MatrixXd V(cols, m + 1);
+	MatrixXd U(rows, m);
+	MatrixXd B = MatrixXd::Zero(m, m);
+	VectorXd u(rows), v(cols), h;
+	uint64_t state = 0;
+
+	eigs_random_vector(v, state);
+	V.col(0) = v.normalized();
+	int p = 0;
+	for (int restart = 0;; ++restart) {
+		double beta = 0;
+		for (int j = p; j < m; ++j) {
+			op.multiply(V.col(j), u);
+			double norm = eigs_orthogonalize(U, j, u, h);
+			B.col(j).head(j) = h;
+			const double alpha = u.norm();
+			if (alpha > eps * norm) {
+				B(j, j) = alpha;
+				U.col(j) = u / alpha;
+			}
+			else {
+				// A v_j lies in span(U): continue with an orthogonal left vector.
+				B(j, j) = 0;
+				eigs_random_vector(u, state);
+				eigs_orthogonalize(U, j, u, h);
+				U.col(j) = u.normalized();
+			}
+
+			op.multiply_transpose(U.col(j), v);
+			norm = eigs_orthogonalize(V, j + 1, v, h);
+			beta = v.norm();
+			if (beta > eps * norm) {
+				V.col(j + 1) = v / beta;
+				continue;
+			}
+
+			// invariant subspace: continue with a right vector orthogonal to it.
+			beta = 0;
+			V.col(j + 1).setZero();
+			if (j + 1 < cols) {
+				eigs_random_vector(v, state);
+				eigs_orthogonalize(V, j + 1, v, h);
+				V.col(j + 1) = v.normalized();
+			}
+		}
+
+		BDCSVD<MatrixXd> svd(B, ComputeFullU | ComputeFullV);
+		const VectorXd& sigma = svd.singularValues();
+		const MatrixXd& P = svd.matrixU();
+		const MatrixXd& Q = svd.matrixV();
+		int done = 0;
+		for (int i = 0; i < k; ++i) {
+			if (abs(beta * P(m - 1, i)) <= tolerance * sigma(0))
+				++done;
+		}
+
+		*converged = done;
+		*restarts = restart;
+		if (done == k || restart >= maxRestarts) {
+			leftVectors.noalias() = U * P.leftCols(k);
+			singularValues = sigma.head(k);
+			rightVectors.noalias() = V.leftCols(m) * Q.leftCols(k);
+			return done == k ? Success : NoConvergence;
+		}
+
+		p = min((m + k) / 2, m - 1);
+		U.leftCols(p) = U * P.leftCols(p);
+		V.leftCols(p) = V.leftCols(m) * Q.leftCols(p);
+		V.col(p) = V.col(m);
+		B.setZero();
+		B.diagonal().head(p) = sigma.head(p);
+	}
 }
 
-EXPORT_API(void) ssolve_sparseQR_(
+// k largest singular triplets of a sparse matrix. subspace <= 0 uses max(2k + 1, 20) Lanczos
+// vectors, maxRestarts <= 0 allows 1000 restarts and tolerance <= 0 asks for a residual
+// ||A^T u - s v|| of 1e-10 relative to the largest singular value. U (row x k), S and V
+// (col x k) are written in decreasing order, even without convergence, with the largest entry
+// of each right vector positive. Returns a ComputationInfo.
+EXPORT_API(int) ssvds_(
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
 	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout) {
-
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	int k,
+	int subspace,
+	int maxRestarts,
+	double tolerance,
+	_Out_ double* uout,
+	_Out_ double* sout,
+	_Out_ double* vout,
+	_Out_ int* restarts,
+	_Out_ int* converged)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	apply_thread_budget();
+	*restarts = 0;
+	*converged = 0;
+	const int minRowsCols = MIN(row, col);
+	if (k < 1 || k > minRowsCols) {
+		return InvalidInput;
+	}
 
-	SparseQR<SparseMatrix<double>, COLAMDOrdering<int>> solver;
+	BidiagonalizationOperator op(row, col, outerIndex, innerIndex, values);
+	const int m = min(minRowsCols, max(subspace > 0 ? subspace : max(2 * k + 1, 20), k + 1));
+	maxRestarts = maxRestarts > 0 ? maxRestarts : 1000;
+	tolerance = tolerance > 0 ? tolerance : 1e-10;
+	MatrixXd left, right;
+	VectorXd sigma;
+	const int info = lanczos_bidiagonalization(op, row, col, k, m, maxRestarts, tolerance, left, sigma, right, restarts, converged);
+
+	for (int i = 0; i < k; ++i) {
+		Index largest;
+		right.col(i).cwiseAbs().maxCoeff(&largest);
+		if (right(largest, i) < 0) {
+			right.col(i) = -right.col(i);
+			left.col(i) = -left.col(i);
+		}
+	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	Map<MatrixXd>(uout, row, k) = left;
+	Map<VectorXd>(sout, k) = sigma;
+	Map<MatrixXd>(vout, col, k) = right;
+	return info;
 }
 
-// unsupported!
-EXPORT_API(bool) ssolve_GMRES_(
-	int row,
-	int col,
-	int nnz,
-	int maxIterations,
-	double tolerance,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout,
-	_Out_ int* iterations,
-	_Out_ double* error) {
+// Matrix Market (.mtx) input and output. Files are memory-mapped and the body is split at line
+// boundaries into one chunk per thread, each chunk parsed with from_chars into its own buffers;
+// coordinate files are then assembled into compressed column storage by sparse_from_triplets.
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+// must match EigenCore.Core.IO.MatrixMarket.
+enum MatrixMarketFormat
+{
+	MatrixMarketCoordinate = 0,
+	MatrixMarketArray = 1
+};
+
+// status of a file read, shared by the Matrix Market and binary matrix files.
+enum MatrixFileStatus
+{
+	MatrixFileOk = 0,
+	MatrixFileIOError = 1,
+	MatrixFileFormatError = 2
+};
 
-	GMRES<SparseMatrix<double>> solver;
+enum MatrixMarketSymmetry
+{
+	MatrixMarketGeneral = 0,
+	MatrixMarketSymmetric = 1,
+	MatrixMarketSkewSymmetric = 2
+};
+
+#if defined _WIN32 || defined _WIN64
+// paths cross the interface as UTF-8.
+static wstring widen(const char* path)
+{
+	const int length = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+	wstring result(length > 1 ? length - 1 : 0, L'\0');
+	if (length > 1)
+		MultiByteToWideChar(CP_UTF8, 0, path, -1, &result[0], length);
+	return result;
+}
+#endif
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
+// read-only mapping of a whole file, empty files are not mapped.
+class MappedFile
+{
+public:
+	explicit MappedFile(const char* path)
+	{
+#if defined _WIN32 || defined _WIN64
+		file = CreateFileW(widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		LARGE_INTEGER fileSize;
+		if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+			return;
+		mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (view == nullptr)
+			return;
+		length = static_cast<size_t>(fileSize.QuadPart);
+#else
+		descriptor = open(path, O_RDONLY);
+		struct stat info;
+		if (descriptor < 0 || fstat(descriptor, &info) != 0 || info.st_size == 0)
+			return;
+		void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (view == MAP_FAILED)
+			return;
+		length = static_cast<size_t>(info.st_size);
+		madvise(view, length, MADV_SEQUENTIAL);
+#endif
+		begin = static_cast<const char*>(view);
 	}
 
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
+	~MappedFile()
+	{
+#if defined _WIN32 || defined _WIN64
+		if (begin != nullptr)
+			UnmapViewOfFile(begin);
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE)
+			CloseHandle(file);
+#else
+		if (begin != nullptr)
+			munmap(const_cast<char*>(begin), length);
+		if (descriptor >= 0)
+			close(descriptor);
+#endif
 	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool is_open() const { return begin != nullptr; }
+	const char* data() const { return begin; }
+	const char* end() const { return begin + length; }
+
+private:
+	const char* begin = nullptr;
+	size_t length = 0;
+#if defined _WIN32 || defined _WIN64
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+#else
+	int descriptor = -1;
+#endif
+};
+
+static const char* skip_blanks(const char* p, const char* end)
+{
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+		++p;
+	return p;
+}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+static const char* next_line(const char* p, const char* end)
+{
+	const char* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+	return newline != nullptr ? newline + 1 : end;
+}
 
-	return solver.info() == Success;
+// parses the next number on the current line.
+template<typename T>
+static bool parse_number(const char*& p, const char* end, T& value)
+{
+	p = skip_blanks(p, end);
+	if (p < end && *p == '+')
+		++p;
+	const from_chars_result result = from_chars(p, end, value);
+	if (result.ec != errc())
+		return false;
+	p = result.ptr;
+	return true;
 }
 
-// unsupported!
-EXPORT_API(bool) ssolve_MINRES_(
-	int row,
-	int col,
-	int nnz,
-	int maxIterations,
-	double tolerance,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout,
-	_Out_ int* iterations,
-	_Out_ double* error) {
+// start of every chunk, chunks begin at a line and there is one more bound than parts.
+static vector<const char*> split_lines(const char* begin, const char* end, int parts)
+{
+	vector<const char*> bounds(parts + 1, end);
+	bounds[0] = begin;
+	for (int part = 1; part < parts; ++part)
+	{
+		const char* p = begin + (end - begin) * part / parts;
+		bounds[part] = max(bounds[part - 1], next_line(p - 1, end));
+	}
+	return bounds;
+}
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+// entries of one chunk of a file, error is the offset of the first bad entry or -1.
+struct MatrixMarketChunk
+{
+	vector<int> rows;
+	vector<int> cols;
+	vector<double> values;
+	long long entries = 0;
+	long long error = -1;
+};
+
+class MatrixMarketMatrix
+{
+public:
+	int status = MatrixFileOk;
+	string error;
+	int format = MatrixMarketCoordinate;
+	int rows = 0;
+	int cols = 0;
+	vector<int> outerIndex;
+	vector<int> innerIndex;
+	vector<double> values;
+
+	void read(const char* path)
+	{
+		MappedFile file(path);
+		if (!file.is_open())
+		{
+			fail(MatrixFileIOError, string("cannot map ") + path + ", it is missing, unreadable or empty");
+			return;
+		}
+
+		const char* p = file.data();
+		const char* end = file.end();
+		const char* banner = next_line(p, end);
+		if (!read_banner(string(p, banner)))
+			return;
+
+		long long sizes[3] = { 0, 0, 0 };
+		const int count = format == MatrixMarketCoordinate ? 3 : 2;
+		bool sized = false;
+		for (p = banner; !sized && p < end; p = next_line(p, end))
+		{
+			const char* q = skip_blanks(p, end);
+			if (q == end || *q == '\n' || *q == '%')
+				continue;
+
+			for (int k = 0; k < count; ++k)
+			{
+				if (!parse_number(q, end, sizes[k]) || sizes[k] < 0 || sizes[k] > INT_MAX)
+				{
+					fail(MatrixFileFormatError, "invalid size line");
+					return;
+				}
+			}
+			sized = true;
+			p = q;
+		}
+
+		if (!sized)
+		{
+			fail(MatrixFileFormatError, "missing size line");
+			return;
+		}
+
+		rows = static_cast<int>(sizes[0]);
+		cols = static_cast<int>(sizes[1]);
+		if (symmetry != MatrixMarketGeneral && rows != cols)
+		{
+			fail(MatrixFileFormatError, "symmetric matrices must be square");
+			return;
+		}
+
+		const int parts = end - p > (1 << 20) ? effective_num_threads() : 1;
+		const vector<const char*> bounds = split_lines(p, end, parts);
+		vector<MatrixMarketChunk> chunks(parts);
+		#pragma omp parallel for schedule(static) num_threads(parts)
+		for (int part = 0; part < parts; ++part)
+		{
+			if (format == MatrixMarketCoordinate)
+				parse_coordinates(bounds[part], bounds[part + 1], file.data(), chunks[part]);
+			else
+				parse_values(bounds[part], bounds[part + 1], file.data(), chunks[part]);
+		}
+
+		long long entries = 0;
+		for (const MatrixMarketChunk& chunk : chunks)
+		{
+			if (chunk.error >= 0)
+			{
+				fail(MatrixFileFormatError, "invalid entry at byte " + to_string(chunk.error));
+				return;
+			}
+			entries += chunk.entries;
+		}
+
+		if (format == MatrixMarketCoordinate)
+			assemble_coordinates(chunks, entries, sizes[2]);
+		else
+			assemble_array(chunks, entries);
+	}
 
-	MINRES<SparseMatrix<double>> solver;
+private:
+	bool pattern = false;
+	int symmetry = MatrixMarketGeneral;
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
+	void fail(int code, const string& message)
+	{
+		status = code;
+		error = message;
 	}
 
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
+	bool read_banner(string line)
+	{
+		transform(line.begin(), line.end(), line.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+		istringstream tokens(line);
+		string header, object, storage, field, symmetryName;
+		tokens >> header >> object >> storage >> field >> symmetryName;
+		if (header != "%%matrixmarket" || object != "matrix" || (storage != "coordinate" && storage != "array"))
+		{
+			fail(MatrixFileFormatError, "not a Matrix Market matrix file");
+			return false;
+		}
+
+		if (field != "real" && field != "double" && field != "integer" && field != "pattern")
+		{
+			fail(MatrixFileFormatError, "unsupported field " + field);
+			return false;
+		}
+
+		// hermitian is symmetric for the real fields supported here.
+		if (symmetryName == "symmetric" || symmetryName == "hermitian")
+			symmetry = MatrixMarketSymmetric;
+		else if (symmetryName == "skew-symmetric")
+			symmetry = MatrixMarketSkewSymmetric;
+		else if (symmetryName != "general")
+		{
+			fail(MatrixFileFormatError, "unsupported symmetry " + symmetryName);
+			return false;
+		}
+
+		format = storage == "coordinate" ? MatrixMarketCoordinate : MatrixMarketArray;
+		pattern = field == "pattern";
+		if (pattern && format == MatrixMarketArray)
+		{
+			fail(MatrixFileFormatError, "pattern is only valid for coordinate files");
+			return false;
+		}
+
+		return true;
 	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	void parse_coordinates(const char* p, const char* end, const char* file, MatrixMarketChunk& chunk) const
+	{
+		while (p < end)
+		{
+			p = skip_blanks(p, end);
+			if (p == end)
+				break;
+			if (*p == '\n' || *p == '%')
+			{
+				p = next_line(p, end);
+				continue;
+			}
+
+			const char* entry = p;
+			long long i, j;
+			double value = 1.0;
+			if (!parse_number(p, end, i) || !parse_number(p, end, j) || (!pattern && !parse_number(p, end, value)) ||
+				i < 1 || i > rows || j < 1 || j > cols)
+			{
+				chunk.error = entry - file;
+				return;
+			}
+
+			chunk.rows.push_back(static_cast<int>(i - 1));
+			chunk.cols.push_back(static_cast<int>(j - 1));
+			chunk.values.push_back(value);
+			if (symmetry != MatrixMarketGeneral && i != j)
+			{
+				chunk.rows.push_back(static_cast<int>(j - 1));
+				chunk.cols.push_back(static_cast<int>(i - 1));
+				chunk.values.push_back(symmetry == MatrixMarketSkewSymmetric ? -value : value);
+			}
+			++chunk.entries;
+			p = next_line(p, end);
+		}
+	}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+	void parse_values(const char* p, const char* end, const char* file, MatrixMarketChunk& chunk) const
+	{
+		while (p < end)
+		{
+			p = skip_blanks(p, end);
+			if (p == end)
+				break;
+			if (*p == '\n' || *p == '%')
+			{
+				p = next_line(p, end);
+				continue;
+			}
+
+			const char* entry = p;
+			double value;
+			if (!parse_number(p, end, value))
+			{
+				chunk.error = entry - file;
+				return;
+			}
+
+			chunk.values.push_back(value);
+			++chunk.entries;
+			p = next_line(p, end);
+		}
+	}
 
-	return solver.info() == Success;
+	void assemble_coordinates(vector<MatrixMarketChunk>& chunks, long long entries, long long expected)
+	{
+		if (entries != expected)
+		{
+			fail(MatrixFileFormatError, "expected " + to_string(expected) + " entries, found " + to_string(entries));
+			return;
+		}
+
+		size_t count = 0;
+		for (const MatrixMarketChunk& chunk : chunks)
+			count += chunk.values.size();
+		if (count > static_cast<size_t>(INT_MAX))
+		{
+			fail(MatrixFileFormatError, "too many non zeros");
+			return;
+		}
+
+		vector<int> rowIndices, colIndices;
+		rowIndices.reserve(count);
+		colIndices.reserve(count);
+		values.reserve(count);
+		for (MatrixMarketChunk& chunk : chunks)
+		{
+			rowIndices.insert(rowIndices.end(), chunk.rows.begin(), chunk.rows.end());
+			colIndices.insert(colIndices.end(), chunk.cols.begin(), chunk.cols.end());
+			values.insert(values.end(), chunk.values.begin(), chunk.values.end());
+			chunk = MatrixMarketChunk();
+		}
+
+		const vector<double> tripletValues(move(values));
+		outerIndex.resize(cols + 1);
+		innerIndex.resize(count);
+		values.resize(count);
+		const int nnz = sparse_from_triplets(rows, cols, static_cast<int>(count), rowIndices.data(), colIndices.data(), tripletValues.data(),
+			outerIndex.data(), innerIndex.data(), values.data());
+		innerIndex.resize(nnz);
+		values.resize(nnz);
+	}
+
+	// array files list the columns in order, only the lower (strictly lower when skew-symmetric)
+	// triangle of symmetric matrices.
+	void assemble_array(const vector<MatrixMarketChunk>& chunks, long long entries)
+	{
+		const long long n = rows;
+		const long long expected = symmetry == MatrixMarketGeneral ? n * cols :
+			symmetry == MatrixMarketSymmetric ? n * (n + 1) / 2 : n * (n - 1) / 2;
+		if (entries != expected)
+		{
+			fail(MatrixFileFormatError, "expected " + to_string(expected) + " entries, found " + to_string(entries));
+			return;
+		}
+
+		values.assign(static_cast<size_t>(n) * cols, 0.0);
+		Map<MatrixXd> matrix(values.data(), rows, cols);
+		int i = symmetry == MatrixMarketSkewSymmetric ? 1 : 0;
+		int j = 0;
+		for (const MatrixMarketChunk& chunk : chunks)
+		{
+			for (double value : chunk.values)
+			{
+				while (i >= rows)
+				{
+					++j;
+					i = symmetry == MatrixMarketGeneral ? 0 : j + (symmetry == MatrixMarketSkewSymmetric ? 1 : 0);
+				}
+
+				matrix(i, j) = value;
+				if (symmetry != MatrixMarketGeneral && i != j)
+					matrix(j, i) = symmetry == MatrixMarketSkewSymmetric ? -value : value;
+				++i;
+			}
+		}
+	}
+};
+
+static FILE* open_output(const char* path)
+{
+#if defined _WIN32 || defined _WIN64
+	return _wfopen(widen(path).c_str(), L"wb");
+#else
+	return fopen(path, "wb");
+#endif
 }
 
-// unsupported!
-EXPORT_API(bool) ssolve_DGMRES_(
-	int row,
-	int col,
-	int nnz,
-	int maxIterations,
-	double tolerance,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout,
-	_Out_ int* iterations,
-	_Out_ double* error) {
+// buffered writer that formats numbers with to_chars, the shortest text that reads back exactly.
+class MatrixMarketWriter
+{
+public:
+	explicit MatrixMarketWriter(const char* path) : file(open_output(path)), buffer(1 << 20)
+	{
+	}
 
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<const VectorXd> rhs(inrhs, size);
-	Map<VectorXd> x(vout, size);
+	~MatrixMarketWriter()
+	{
+		if (file != nullptr)
+			fclose(file);
+	}
 
-	MINRES<SparseMatrix<double>> solver;
+	MatrixMarketWriter(const MatrixMarketWriter&) = delete;
+	MatrixMarketWriter& operator=(const MatrixMarketWriter&) = delete;
 
-	if (maxIterations > 0) {
-		solver.setMaxIterations(maxIterations);
+	bool is_open() const { return file != nullptr; }
+
+	void text(const char* value)
+	{
+		const size_t length = strlen(value);
+		reserve(length);
+		memcpy(buffer.data() + used, value, length);
+		used += length;
 	}
 
-	if (tolerance > 0) {
-		solver.setTolerance(tolerance);
+	template<typename T>
+	void number(T value, char separator)
+	{
+		reserve(32);
+		char* first = buffer.data() + used;
+		char* last = to_chars(first, buffer.data() + buffer.size(), value).ptr;
+		*last++ = separator;
+		used += last - first;
 	}
 
-	solver.compute(matrix);
-	x = solver.solve(rhs);
+	bool close()
+	{
+		flush();
+		const bool closed = fclose(file) == 0;
+		file = nullptr;
+		return ok && closed;
+	}
 
-	*iterations = (int)solver.iterations();
-	*error = solver.error();
+private:
+	FILE* file = nullptr;
+	vector<char> buffer;
+	size_t used = 0;
+	bool ok = true;
+
+	void reserve(size_t length)
+	{
+		if (used + length > buffer.size())
+			flush();
+		if (length > buffer.size())
+			buffer.resize(length);
+	}
 
-	return solver.info() == Success;
+	void flush()
+	{
+		if (used > 0 && fwrite(buffer.data(), 1, used, file) != used)
+			ok = false;
+		used = 0;
+	}
+};
+
+// reads a Matrix Market file, always returns a handle; check matrixmarket_info_ before copying.
+EXPORT_API(void*) matrixmarket_read_(_In_ const char* path)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	MatrixMarketMatrix* matrix = new MatrixMarketMatrix();
+	matrix->read(path);
+	INSTRUMENT_RESIZE(matrix->rows, matrix->cols, static_cast<long long>(matrix->values.size()));
+	return matrix;
 }
 
-EXPORT_API(bool) snormal_equations__leastsquares_sparselu_(
-	int row,
-	int col,
-	int nnz,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* inrhs,
-	_In_ int size,
-	_Out_ double* vout){
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<VectorXd> rhs(inrhs, row);
-	Map<VectorXd> result(vout, col);
+// returns the MatrixFileStatus of the read, nnz is rows * cols for array files.
+EXPORT_API(int) matrixmarket_info_(_In_ void* handle, _Out_ int* format, _Out_ int* rows, _Out_ int* cols, _Out_ int* nnz)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	const MatrixMarketMatrix* matrix = static_cast<const MatrixMarketMatrix*>(handle);
+	*format = matrix->format;
+	*rows = matrix->rows;
+	*cols = matrix->cols;
+	*nnz = static_cast<int>(matrix->values.size());
+	return matrix->status;
+}
 
-	SparseLU<SparseMatrix<double>> solver;
-	solver.compute((matrix.transpose() * matrix));
-	result = solver.solve(matrix.transpose() * rhs);
+EXPORT_API(const char*) matrixmarket_error_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return static_cast<const MatrixMarketMatrix*>(handle)->error.c_str();
+}
 
-	return solver.info() == Success;
+// compressed column storage of a coordinate file.
+EXPORT_API(void) matrixmarket_sparse_(_In_ void* handle, _Out_ int* outerIndex, _Out_ int* innerIndex, _Out_ double* values)
+{
+	INSTRUMENT_EXPORT(static_cast<const MatrixMarketMatrix*>(handle)->rows, static_cast<const MatrixMarketMatrix*>(handle)->cols, static_cast<const MatrixMarketMatrix*>(handle)->values.size());
+	const MatrixMarketMatrix* matrix = static_cast<const MatrixMarketMatrix*>(handle);
+	copy(matrix->outerIndex.begin(), matrix->outerIndex.end(), outerIndex);
+	copy(matrix->innerIndex.begin(), matrix->innerIndex.end(), innerIndex);
+	copy(matrix->values.begin(), matrix->values.end(), values);
 }
 
-EXPORT_API(double) snorm_(
-	int row,
-	int col,
-	int nnz,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values) {
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
+// column-major dense values of a file in either format.
+EXPORT_API(void) matrixmarket_dense_(_In_ void* handle, _Out_ double* values)
+{
+	INSTRUMENT_EXPORT(static_cast<const MatrixMarketMatrix*>(handle)->rows, static_cast<const MatrixMarketMatrix*>(handle)->cols, 0);
+	const MatrixMarketMatrix* matrix = static_cast<const MatrixMarketMatrix*>(handle);
+	Map<MatrixXd> result(values, matrix->rows, matrix->cols);
+	if (matrix->format == MatrixMarketArray)
+	{
+		result = Map<const MatrixXd>(matrix->values.data(), matrix->rows, matrix->cols);
+		return;
+	}
 
-	return matrix.norm();
+	result = Map<const SparseMatrix<double>>(matrix->rows, matrix->cols, static_cast<int>(matrix->values.size()),
+		matrix->outerIndex.data(), matrix->innerIndex.data(), matrix->values.data()).toDense();
 }
 
-EXPORT_API(double) ssquaredNorm_(
-	int row,
-	int col,
-	int nnz,
-	_In_ int* outerIndex,
-	_In_ int* innerIndex,
-	_In_ double* values) {
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	return matrix.squaredNorm();
+EXPORT_API(void) matrixmarket_destroy_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<MatrixMarketMatrix*>(handle);
 }
 
-EXPORT_API(double) srelative_error_(
+// writes a coordinate real general file, returns false when the file cannot be written.
+EXPORT_API(bool) smatrixmarket_write_(
+	_In_ const char* path,
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,
-	_In_ double* v1,
-	_In_ double* v2) {
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> x(v2, row);
-	return (matrix * x - rhs).norm() / rhs.norm();
+	_In_ double* values)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	MatrixMarketWriter writer(path);
+	if (!writer.is_open())
+		return false;
+
+	writer.text("%%MatrixMarket matrix coordinate real general\n");
+	writer.number(row, ' ');
+	writer.number(col, ' ');
+	writer.number(nnz, '\n');
+	for (int j = 0; j < col; ++j)
+	{
+		for (int p = outerIndex[j]; p < outerIndex[j + 1]; ++p)
+		{
+			writer.number(innerIndex[p] + 1, ' ');
+			writer.number(j + 1, ' ');
+			writer.number(values[p], '\n');
+		}
+	}
+
+	return writer.close();
 }
 
-EXPORT_API(double) sabsolute_error_(
+// writes an array real general file, returns false when the file cannot be written.
+EXPORT_API(bool) dmatrixmarket_write_(_In_ const char* path, _In_ double* values, int row, int col)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	MatrixMarketWriter writer(path);
+	if (!writer.is_open())
+		return false;
+
+	writer.text("%%MatrixMarket matrix array real general\n");
+	writer.number(row, ' ');
+	writer.number(col, '\n');
+	const long long count = static_cast<long long>(row) * col;
+	for (long long k = 0; k < count; ++k)
+		writer.number(values[k], '\n');
+
+	return writer.close();
+}
+
+// Binary matrix file, little-endian: a 64-byte header followed by 64-byte aligned sections,
+// outerIndex (cols + 1 int32), innerIndex (nnz int32) and values (nnz double) for sparse
+// matrices, column-major values (rows * cols double) for dense ones. Opening maps the file and
+// hands out pointers into the mapping, which every export taking caller arrays accepts as is.
+static const char matrix_file_magic[8] = { 'E', 'I', 'G', 'C', 'M', 'A', 'T', '\0' };
+static const uint32_t matrix_file_version = 1;
+static const uint64_t matrix_file_alignment = 64;
+
+// must match EigenCore.Core.IO.MatrixFile.
+enum MatrixFileKind
+{
+	MatrixFileSparse = 0,
+	MatrixFileDense = 1
+};
+
+struct MatrixFileHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t kind;
+	int64_t rows;
+	int64_t cols;
+	int64_t nnz;
+	uint64_t outerOffset;
+	uint64_t innerOffset;
+	uint64_t valuesOffset;
+};
+
+static_assert(sizeof(MatrixFileHeader) == 64, "the header is part of the file format");
+
+static uint64_t align_section(uint64_t offset)
+{
+	return (offset + matrix_file_alignment - 1) / matrix_file_alignment * matrix_file_alignment;
+}
+
+// writes the header, then every section at its offset.
+static bool write_matrix_file(const char* path, MatrixFileHeader header,
+	const void* outerIndex, const void* innerIndex, const void* values, uint64_t valuesBytes)
+{
+	memcpy(header.magic, matrix_file_magic, sizeof(header.magic));
+	header.version = matrix_file_version;
+	const uint64_t outerBytes = header.kind == MatrixFileSparse ? (header.cols + 1) * sizeof(int) : 0;
+	const uint64_t innerBytes = header.kind == MatrixFileSparse ? header.nnz * sizeof(int) : 0;
+	header.outerOffset = align_section(sizeof(MatrixFileHeader));
+	header.innerOffset = align_section(header.outerOffset + outerBytes);
+	header.valuesOffset = align_section(header.innerOffset + innerBytes);
+
+	FILE* file = open_output(path);
+	if (file == nullptr)
+		return false;
+
+	const char padding[matrix_file_alignment] = {};
+	uint64_t position = 0;
+	auto section = [&](uint64_t offset, const void* data, uint64_t bytes)
+	{
+		const bool ok = fwrite(padding, 1, offset - position, file) == offset - position &&
+			(bytes == 0 || fwrite(data, 1, bytes, file) == bytes);
+		position = offset + bytes;
+		return ok;
+	};
+
+	bool ok = section(0, &header, sizeof(header)) &&
+		section(header.outerOffset, outerIndex, outerBytes) &&
+		section(header.innerOffset, innerIndex, innerBytes) &&
+		section(header.valuesOffset, values, valuesBytes);
+	ok = fclose(file) == 0 && ok;
+	return ok;
+}
+
+class MatrixFile
+{
+public:
+	int status = MatrixFileOk;
+	string error;
+	MatrixFileHeader header = {};
+
+	explicit MatrixFile(const char* path) : file(path)
+	{
+		if (!file.is_open())
+		{
+			fail(MatrixFileIOError, string("cannot map ") + path + ", it is missing, unreadable or empty");
+			return;
+		}
+
+		const uint64_t size = static_cast<uint64_t>(file.end() - file.data());
+		if (size < sizeof(MatrixFileHeader) || memcmp(file.data(), matrix_file_magic, sizeof(matrix_file_magic)) != 0)
+		{
+			fail(MatrixFileFormatError, "not a binary matrix file");
+			return;
+		}
+
+		memcpy(&header, file.data(), sizeof(header));
+		if (header.version != matrix_file_version)
+		{
+			fail(MatrixFileFormatError, "unsupported version " + to_string(header.version));
+			return;
+		}
+
+		const bool sparse = header.kind == MatrixFileSparse;
+		if ((!sparse && header.kind != MatrixFileDense) || header.rows < 0 || header.rows > INT_MAX ||
+			header.cols < 0 || header.cols > INT_MAX || header.nnz < 0 || header.nnz > INT_MAX ||
+			(!sparse && header.rows * header.cols > INT_MAX))
+		{
+			fail(MatrixFileFormatError, "invalid header");
+			return;
+		}
+
+		const uint64_t count = sparse ? header.nnz : header.rows * header.cols;
+		if (!section_fits(header.valuesOffset, count * sizeof(double), size) ||
+			(sparse && (!section_fits(header.outerOffset, (header.cols + 1) * sizeof(int), size) ||
+				!section_fits(header.innerOffset, header.nnz * sizeof(int), size))))
+		{
+			fail(MatrixFileFormatError, "truncated or misaligned sections");
+			return;
+		}
+
+		if (sparse && (outer_index()[0] != 0 || outer_index()[header.cols] != header.nnz))
+		{
+			fail(MatrixFileFormatError, "outer index does not match the number of non zeros");
+			return;
+		}
+	}
+
+	const int* outer_index() const { return reinterpret_cast<const int*>(file.data() + header.outerOffset); }
+	const int* inner_index() const { return reinterpret_cast<const int*>(file.data() + header.innerOffset); }
+	const double* values() const { return reinterpret_cast<const double*>(file.data() + header.valuesOffset); }
+
+private:
+	MappedFile file;
+
+	void fail(int code, const string& message)
+	{
+		status = code;
+		error = message;
+	}
+
+	static bool section_fits(uint64_t offset, uint64_t bytes, uint64_t size)
+	{
+		return offset % matrix_file_alignment == 0 && offset >= sizeof(MatrixFileHeader) && offset <= size && bytes <= size - offset;
+	}
+};
+
+// maps a binary matrix file, always returns a handle; check matrixfile_info_ before using the data.
+EXPORT_API(void*) matrixfile_open_(_In_ const char* path)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	MatrixFile* file = new MatrixFile(path);
+	INSTRUMENT_RESIZE(file->header.rows, file->header.cols, file->header.nnz);
+	return file;
+}
+
+// returns the MatrixFileStatus of the open.
+EXPORT_API(int) matrixfile_info_(_In_ void* handle, _Out_ int* kind, _Out_ int* rows, _Out_ int* cols, _Out_ int* nnz)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	const MatrixFile* file = static_cast<const MatrixFile*>(handle);
+	*kind = static_cast<int>(file->header.kind);
+	*rows = static_cast<int>(file->header.rows);
+	*cols = static_cast<int>(file->header.cols);
+	*nnz = static_cast<int>(file->header.nnz);
+	return file->status;
+}
+
+EXPORT_API(const char*) matrixfile_error_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return static_cast<const MatrixFile*>(handle)->error.c_str();
+}
+
+// pointers into the mapping, valid until matrixfile_close_.
+EXPORT_API(void) matrixfile_sparse_(_In_ void* handle, _Out_ const int** outerIndex, _Out_ const int** innerIndex, _Out_ const double** values)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	const MatrixFile* file = static_cast<const MatrixFile*>(handle);
+	*outerIndex = file->outer_index();
+	*innerIndex = file->inner_index();
+	*values = file->values();
+}
+
+EXPORT_API(const double*) matrixfile_dense_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	return static_cast<const MatrixFile*>(handle)->values();
+}
+
+EXPORT_API(void) matrixfile_close_(_In_ void* handle)
+{
+	INSTRUMENT_EXPORT(0, 0, 0);
+	delete static_cast<MatrixFile*>(handle);
+}
+
+// writes a sparse binary matrix file, returns false when the file cannot be written.
+EXPORT_API(bool) smatrixfile_write_(
+	_In_ const char* path,
 	int row,
 	int col,
 	int nnz,
 	_In_ int* outerIndex,
 	_In_ int* innerIndex,
-	_In_ double* values,	
-	_In_ double* v1,
-	_In_ double* v2) {
-	Map<const SparseMatrix<double>>  matrix(row, col, nnz, outerIndex, innerIndex, values);
-	Map<VectorXd> rhs(v1, row);
-	Map<VectorXd> x(v2, row);
-	return (matrix * x - rhs).norm();
+	_In_ double* values)
+{
+	INSTRUMENT_EXPORT(row, col, nnz);
+	MatrixFileHeader header = {};
+	header.kind = MatrixFileSparse;
+	header.rows = row;
+	header.cols = col;
+	header.nnz = nnz;
+	return write_matrix_file(path, header, outerIndex, innerIndex, values, static_cast<uint64_t>(nnz) * sizeof(double));
+}
+
+// writes a dense binary matrix file, returns false when the file cannot be written.
+EXPORT_API(bool) dmatrixfile_write_(_In_ const char* path, _In_ double* values, int row, int col)
+{
+	INSTRUMENT_EXPORT(row, col, 0);
+	MatrixFileHeader header = {};
+	header.kind = MatrixFileDense;
+	header.rows = row;
+	header.cols = col;
+	return write_matrix_file(path, header, nullptr, nullptr, values, static_cast<uint64_t>(row) * col * sizeof(double));
 }
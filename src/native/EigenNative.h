@@ -8,15 +8,38 @@
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <numeric>
+#include <charconv>
+#include <cstdio>
+#include <sstream>
+#include <string>
 #define UNUSED(x) (void)(x)
 #define DEBUG_ONLY(x) (void)(x)
 #define MIN(a,b) (((a)<(b))?(a):(b))
 
 #if defined _WIN32 || defined _WIN64
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
 #include <intrin.h>
 #include <sal.h>
 #define EXPORT_API(ret) extern "C" __declspec(dllexport) ret
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "UnixSal.h"
 #define EXPORT_API(ret) extern "C" __attribute__((visibility("default"))) ret
 #define __forceinline __attribute__((always_inline)) inline
@@ -0,0 +1,1084 @@
+﻿// kernel_benchmark.cpp : every exported kernel over a size sweep, results as JSON.
+//
+// usage: kernel_benchmark [--scale quick|default|large] [--filter text] [--repetitions n]
+//                         [--threads n] [--output file]
+//
+// Inputs are generated with a fixed seed, nothing is downloaded: random dense matrices
+// (symmetric positive definite ones for the Cholesky family), 2D and 3D Laplacians, banded
+// diagonally dominant matrices and power-law graph Laplacians (Chung-Lu degrees, gamma 2.5).
+// Each kernel runs once to warm up, then is repeated until a sample takes at least a
+// millisecond; the best and median sample of `repetitions` are reported. GFLOP/s and GB/s
+// follow the usual textbook operation counts and the minimum traffic of the arguments,
+// they are null when a kernel has no meaningful count (sparse factorizations, file IO
+// reports bytes only). Progress goes to stderr, JSON to stdout or --output.
+//
+// Handle exports are timed through the operation they serve (create + compute + destroy,
+// solve on a computed handle); thread, SIMD and error-string accessors are only used for
+// the report.
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C"
+{
+	void set_num_threads_(int threads);
+	int get_num_threads_();
+	const char* simd_instruction_sets_in_use_();
+
+	double ddot_(double* v1, double* v2, int length1);
+	void dadd_(double* v1, double* v2, int length1, double* vout);
+	void dscale_(double* v1, double scale, int length1, double* vout);
+	void dvaxpy_(double alpha, double* v1, int length, double* vout);
+	void dvaxpby_(double alpha, double* v1, double beta, int length, double* vout);
+	void dvscal_(double alpha, int length, double* vout);
+	void dvcopy_(double* v1, int length, double* vout);
+	double dvdot_squared_norm_(double* v1, double* v2, int length, double* squaredNorm);
+	double dvcg_update_(double alpha, double* p, double* q, int length, double* x, double* r);
+	double dvnorm_(double* v1, int size);
+	double dvsquared_norm_(double* v1, int size);
+	double dvlp1_norm_(double* v1, int size);
+	double dvlpinf_norm_(double* v1, int size);
+	void dminus_(double* m1, int row1, int col1, double* m2, int row2, int col2, double* vout);
+	void dmult_(double* m1, int row1, int col1, double* m2, int row2, int col2, double* vout);
+	void dgemm_(double* m1, int row1, int col1, int transpose1, double* m2, int row2, int col2, int transpose2, double alpha, double beta, double* vout);
+	void dmultv_(double* m1, int row1, int col1, double* v1, int length, double* vout);
+	void dtransp_(double* m1, int row1, int col1, double* vout);
+	void dmultt_(double* v1, int row1, int col1, double* v2, int row2, int col2, double* vout);
+	void da_multt_(double* m1, int row1, int col1, double* vout);
+	void da_tmult_(double* m1, int row1, int col1, double* vout);
+	double dtrace_(double* m1, int row1, int col1);
+	double dnorm_(double* m1, int row1, int col1);
+	double dsquared_norm_(double* m1, int row1, int col1);
+	double dlp1_norm_(double* m1, int row1, int col1);
+	double dlpinf_norm_(double* m1, int row1, int col1);
+	void deigenvalues_(double* m1, int size, double* realEigen, double* imagEigen, double* realVectors, double* imagVectors);
+	void dselfadjoint_eigenvalues_(double* m1, int size, double* realEigen, double* realVectors);
+	void dxplusxt_(double* m1, int size, double* vout);
+	void dxplusa_(double* v1, int row1, int col1, double* v2, int row2, int col2, double* vout);
+	void dsvd_(double* m1, int row, int col, double* uout, double* sout, double* vout);
+	void dsvd_leastsquares_(double* m1, int row, int col, double* v1, double* vout);
+	void dsvd_bdcSvd_(double* m1, int row, int col, double* uout, double* sout, double* vout);
+	void dsvd_bdcSvd__leastsquares_(double* m1, int row, int col, double* v1, double* vout);
+	int dsvd_randomized_(double* m1, int row, int col, int rank, int oversampling, int powerIterations, double* uout, double* sout, double* vout);
+	void dnormal_equations__leastsquares_(double* m1, int row, int col, double* v1, double* vout);
+	void dsolve_colPivHouseholderQr_(double* m1, int row, int col, double* v1, double* vout);
+	void dsolve_partialPivLU_(double* m1, int row, int col, double* v1, double* vout);
+	void dsolve_fullPivLu_(double* m1, int row, int col, double* v1, double* vout);
+	void dsolve_llt_(double* m1, int row, int col, double* v1, double* vout);
+	void dsolve_ldlt_(double* m1, int row, int col, double* v1, double* vout);
+	double ddeterminant_(double* m1, int row, int col);
+	void dinverse_(double* m1, int row, int col, double* vout);
+	double drelative_error_(double* m1, int row, int col, double* v1, double* v2);
+	double dabsolute_error_(double* m1, int row, int col, double* v1, double* v2);
+	void dhouseholderQR_(double* m1, int row, int col, double* v1, double* v2);
+	void dcolPivHouseholderQR_(double* m1, int row, int col, double* v1, double* v2, double* v3);
+	void dfullPivLU_(double* m1, int row, int col, double* v1, double* v2, double* v3, double* v4);
+	void dsolve_completeOrthogonalDecomposition_(double* m1, int row, int col, double* v1, double* vout);
+	void* dfactorization_create_(int solverType);
+	bool dfactorization_compute_(void* handle, double* m1, int row, int col);
+	void dfactorization_solve_(void* handle, double* v1, double* vout);
+	void dfactorization_solveTranspose_(void* handle, double* v1, double* vout);
+	double dfactorization_determinant_(void* handle);
+	double dfactorization_logAbsDeterminant_(void* handle);
+	void dfactorization_destroy_(void* handle);
+	void dsolve_block_(int solverType, double* m1, int row, int col, double* b, int rhsCols, double* vout);
+	void dfactorization_solveBlock_(void* handle, double* b, int rhsCols, double* vout);
+	void dfactorization_solveTransposeBlock_(void* handle, double* b, int rhsCols, double* vout);
+	bool dsolve_mixedPrecision_(int solverType, double* m1, int row, int col, double* v1, double* vout, int* steps);
+
+	float fdot_(float* v1, float* v2, int length1);
+	void fadd_(float* v1, float* v2, int length1, float* vout);
+	void fscale_(float* v1, float scale, int length1, float* vout);
+	float fvnorm_(float* v1, int size);
+	float fvsquared_norm_(float* v1, int size);
+	void fminus_(float* m1, int row1, int col1, float* m2, int row2, int col2, float* vout);
+	void fmult_(float* m1, int row1, int col1, float* m2, int row2, int col2, float* vout);
+	void fmultv_(float* m1, int row1, int col1, float* v1, int length, float* vout);
+	void ftransp_(float* m1, int row1, int col1, float* vout);
+	float ftrace_(float* m1, int row1, int col1);
+	float fnorm_(float* m1, int row1, int col1);
+	float fdeterminant_(float* m1, int row, int col);
+	void finverse_(float* m1, int row, int col, float* vout);
+	void fsolve_colPivHouseholderQr_(float* m1, int row, int col, float* v1, float* vout);
+	void fsolve_partialPivLU_(float* m1, int row, int col, float* v1, float* vout);
+	void fsolve_llt_(float* m1, int row, int col, float* v1, float* vout);
+	void fsolve_ldlt_(float* m1, int row, int col, float* v1, float* vout);
+
+	void dbatch_mult_(int layout, int size, int count, double* a, double* b, double* vout);
+	void dbatch_inverse_(int layout, int size, int count, double* a, double* vout);
+	void dbatch_determinant_(int layout, int size, int count, double* a, double* vout);
+	void dbatch_solve_(int layout, int size, int count, double* a, double* b, double* vout);
+
+	int sfrom_triplets_(int row, int col, int count, int* rowIndices, int* colIndices, double* values, int* outerIndex, int* innerIndex, double* valuesout);
+	int sadd_symbolic_(int row, int col, int* outerIndex1, int* innerIndex1, int* outerIndex2, int* innerIndex2, int* outerIndex);
+	void sadd_(int row, int col, int nnz1, int* outerIndex1, int* innerIndex1, double* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, double* values2, int* outerIndex, int* innerIndex, double* values);
+	void sminus_(int row, int col, int nnz1, int* outerIndex1, int* innerIndex1, double* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, double* values2, int* outerIndex, int* innerIndex, double* values);
+	int smult_symbolic_(int row, int inner, int col, int* outerIndex1, int* innerIndex1, int* outerIndex2, int* innerIndex2, int* outerIndex);
+	void smult_(int row, int inner, int col, int nnz1, int* outerIndex1, int* innerIndex1, double* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, double* values2, int* outerIndex, int* innerIndex, double* values);
+	int smult_pruned_(int row, int inner, int col, int nnz1, int* outerIndex1, int* innerIndex1, double* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, double* values2, double dropTolerance, int* outerIndex, int* innerIndex, double* values);
+	void smultv_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* v1, int length, double* vout);
+	void stranspose_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, int* outerIndexout, int* innerIndexout, double* valuesout);
+	double snorm_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	double ssquaredNorm_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	double srelative_error_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* v1, double* v2);
+	double sabsolute_error_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* v1, double* v2);
+	int ssolve_simplicialLLT_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout, void* stats);
+	int ssolve_simplicialLDLT_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout, void* stats);
+	int ssolve_sparseLU_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout, void* stats);
+	int ssolve_sparseQR_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout, void* stats);
+	bool snormal_equations__leastsquares_sparselu_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout);
+	bool ssolve_block_(int solverType, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* b, int rhsCols, double* vout);
+	bool ssolve_mixedPrecision_(int solverType, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* inrhs, int size, double* vout, int* steps);
+	void* sfactorization_create_(int solverType);
+	void sfactorization_analyzePattern_(void* handle, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	bool sfactorization_factorize_(void* handle, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	bool sfactorization_solve_(void* handle, double* inrhs, int rhsSize, double* vout, int size);
+	bool sfactorization_solveBlock_(void* handle, double* b, int rhsSize, int rhsCols, double* vout, int size);
+	void sfactorization_destroy_(void* handle);
+	void* siterative_create_(int solverType, int preconditioner);
+	bool siterative_compute_(void* handle, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, int fillFactor, double dropTolerance, double shift);
+	bool siterative_solve_(void* handle, int maxIterations, double tolerance, double* inrhs, int size, double* x0, double* vout, int* iterations, double* error, void* monitor);
+	void siterative_destroy_(void* handle);
+	void* smultv_create_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	void* smultv_createRowMajor_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	void smultv_multiply_(void* handle, double* v1, double* vout);
+	void smultv_destroy_(void* handle);
+	int seigs_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, int k, int which, double sigma, int subspace, int maxRestarts,
+		double tolerance, double* realValues, double* imagValues, double* realVectors, double* imagVectors, int* symmetric, int* restarts, int* converged);
+	int ssvds_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, int k, int subspace, int maxRestarts, double tolerance,
+		double* uout, double* sout, double* vout, int* restarts, int* converged);
+
+	int sffrom_triplets_(int row, int col, int count, int* rowIndices, int* colIndices, float* values, int* outerIndex, int* innerIndex, float* valuesout);
+	void sfadd_(int row, int col, int nnz1, int* outerIndex1, int* innerIndex1, float* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, float* values2, int* outerIndex, int* innerIndex, float* values);
+	void sfminus_(int row, int col, int nnz1, int* outerIndex1, int* innerIndex1, float* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, float* values2, int* outerIndex, int* innerIndex, float* values);
+	void sfmultv_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, float* v1, int length, float* vout);
+	void sftranspose_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, int* outerIndexout, int* innerIndexout, float* valuesout);
+	float sfnorm_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values);
+	float sfsquaredNorm_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values);
+	int sfsolve_simplicialLLT_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, float* inrhs, int size, float* vout, void* stats);
+	int sfsolve_simplicialLDLT_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, float* inrhs, int size, float* vout, void* stats);
+	int sfsolve_sparseLU_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, float* inrhs, int size, float* vout, void* stats);
+	int sfsolve_sparseQR_(int row, int col, int nnz, int* outerIndex, int* innerIndex, float* values, float* inrhs, int size, float* vout, void* stats);
+
+	void* matrixmarket_read_(const char* path);
+	int matrixmarket_info_(void* handle, int* format, int* rows, int* cols, int* nnz);
+	void matrixmarket_sparse_(void* handle, int* outerIndex, int* innerIndex, double* values);
+	void matrixmarket_dense_(void* handle, double* values);
+	void matrixmarket_destroy_(void* handle);
+	bool smatrixmarket_write_(const char* path, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	bool dmatrixmarket_write_(const char* path, double* values, int row, int col);
+	void* matrixfile_open_(const char* path);
+	int matrixfile_info_(void* handle, int* kind, int* rows, int* cols, int* nnz);
+	void matrixfile_sparse_(void* handle, const int** outerIndex, const int** innerIndex, const double** values);
+	const double* matrixfile_dense_(void* handle);
+	void matrixfile_close_(void* handle);
+	bool smatrixfile_write_(const char* path, int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	bool dmatrixfile_write_(const char* path, double* values, int row, int col);
+}
+
+typedef bool (*IterativeSolve)(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+typedef bool (*IterativeSolveF)(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+
+extern "C"
+{
+	bool ssolve_conjugateGradient_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool ssolve_biCGSTAB_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool ssolve_LeastSquaresConjugateGradient_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool ssolve_GMRES_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool ssolve_MINRES_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool ssolve_DGMRES_(int, int, int, int, double, int, int, double, double, int*, int*, double*, double*, int, double*, double*, int*, double*, void*);
+	bool sfsolve_conjugateGradient_(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+	bool sfsolve_biCGSTAB_(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+	bool sfsolve_LeastSquaresConjugateGradient_(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+	bool sfsolve_GMRES_(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+	bool sfsolve_MINRES_(int, int, int, int, double, int, int, double, double, int*, int*, float*, float*, int, float*, float*, int*, double*, void*);
+}
+
+using namespace Eigen;
+
+// the same numbering as EigenCore.Core.*.LinearAlgebra.
+enum DenseSolverType { ColPivHouseholderQR = 0, LLTType = 1, LDLTType = 2, PartialPivLUType = 3, FullPivLUType = 4, CompleteOrthogonal = 5, MixedPartialPivLU = 6, MixedLLT = 7 };
+enum DirectSolverType { SimplicialLLTType = 0, SimplicialLDLTType = 1, SparseLUType = 2, SparseQRType = 3, MixedSparseLU = 4, MixedSimplicialLDLT = 5 };
+enum IterativeSolverType { ConjugateGradientType = 0, BiCGSTABType = 1, LeastSquaresCGType = 2, GMRESType = 3, DGMRESType = 4, MINRESType = 5 };
+
+struct Options
+{
+	std::string scale = "default";
+	std::string filter;
+	std::string output;
+	int repetitions = 5;
+	int threads = 0;
+};
+
+struct Result
+{
+	std::string kernel;
+	std::string family;
+	std::string input;
+	long long rows = 0;
+	long long cols = 0;
+	long long nnz = 0;
+	double flops = 0.0;
+	double bytes = 0.0;
+	int iterations = -1;
+	double best = 0.0;
+	double median = 0.0;
+};
+
+struct Sweep
+{
+	std::vector<int> vectors;
+	std::vector<int> dense;
+	std::vector<int> grids2d;
+	std::vector<int> grids3d;
+	std::vector<int> graphs;
+	int batch;
+	// the O(n^3) kernels with large constants, Jacobi SVD and the nonsymmetric eigensolver.
+	int slowDense;
+	// sparse QR.
+	int slowSparse;
+	// direct solves on power-law graphs, which have no small separators and fill in almost completely.
+	int graphDirect;
+};
+
+static Options options;
+static std::vector<Result> results;
+
+static Sweep sweep_for(const std::string& scale)
+{
+	if (scale == "quick")
+		return { { 1000 }, { 32 }, { 16 }, { 6 }, { 500 }, 1000, 32, 500, 500 };
+	if (scale == "large")
+		return { { 10000, 1000000, 50000000 }, { 64, 256, 1024, 2048 }, { 32, 128, 1024 }, { 16, 32, 64 }, { 10000, 100000 }, 1000000, 1024, 5000, 10000 };
+	return { { 10000, 1000000, 10000000 }, { 64, 256, 1024 }, { 32, 128, 512 }, { 16, 32 }, { 5000, 50000 }, 100000, 512, 1024, 5000 };
+}
+
+template<typename Function>
+static double time_seconds(int calls, Function& function)
+{
+	const auto start = std::chrono::steady_clock::now();
+	for (int c = 0; c < calls; ++c)
+		function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// runs one kernel, `function` may update result.flops/bytes/iterations on every call.
+static void bench(Result result, std::function<void(Result&)> body)
+{
+	// kernels containing the filter, or families starting with it ("sparse" runs every sparse family).
+	if (!options.filter.empty() && result.kernel.find(options.filter) == std::string::npos &&
+		result.family.compare(0, options.filter.size(), options.filter) != 0)
+		return;
+
+	auto function = [&]() { body(result); };
+	const double warm = time_seconds(1, function);
+	const int calls = warm >= 1e-3 ? 1 : static_cast<int>(std::min(1e6, std::ceil(1e-3 / std::max(warm, 1e-9))));
+
+	std::vector<double> samples;
+	for (int r = 0; r < options.repetitions; ++r)
+		samples.push_back(time_seconds(calls, function) / calls);
+
+	std::sort(samples.begin(), samples.end());
+	result.best = samples.front();
+	result.median = samples[samples.size() / 2];
+	std::fprintf(stderr, "%-42s %-18s %9lld x %-9lld %12.6f s\n", result.kernel.c_str(), result.input.c_str(),
+		result.rows, result.cols, result.best);
+	results.push_back(result);
+}
+
+static Result make(const char* kernel, const char* family, const std::string& input, long long rows, long long cols,
+	long long nnz = 0, double flops = 0.0, double bytes = 0.0)
+{
+	Result result;
+	result.kernel = kernel;
+	result.family = family;
+	result.input = input;
+	result.rows = rows;
+	result.cols = cols;
+	result.nnz = nnz;
+	result.flops = flops;
+	result.bytes = bytes;
+	return result;
+}
+
+// inputs
+
+static std::mt19937_64 generator(20240601);
+
+static MatrixXd random_dense(int rows, int cols)
+{
+	std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+	MatrixXd matrix(rows, cols);
+	for (Index i = 0; i < matrix.size(); ++i)
+		matrix.data()[i] = uniform(generator);
+	return matrix;
+}
+
+static MatrixXd spd_dense(int n)
+{
+	MatrixXd r = random_dense(n, n);
+	MatrixXd matrix = r.transpose() * r;
+	matrix.diagonal().array() += n;
+	return matrix;
+}
+
+static SparseMatrix<double> from_triplets(int rows, int cols, const std::vector<Triplet<double>>& triplets)
+{
+	SparseMatrix<double> matrix(rows, cols);
+	matrix.setFromTriplets(triplets.begin(), triplets.end());
+	matrix.makeCompressed();
+	return matrix;
+}
+
+static SparseMatrix<double> laplacian2d(int grid)
+{
+	const int n = grid * grid;
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(n) * 5);
+	for (int i = 0; i < grid; ++i)
+	{
+		for (int j = 0; j < grid; ++j)
+		{
+			const int k = i * grid + j;
+			triplets.emplace_back(k, k, 4.0);
+			if (i > 0) triplets.emplace_back(k, k - grid, -1.0);
+			if (i + 1 < grid) triplets.emplace_back(k, k + grid, -1.0);
+			if (j > 0) triplets.emplace_back(k, k - 1, -1.0);
+			if (j + 1 < grid) triplets.emplace_back(k, k + 1, -1.0);
+		}
+	}
+
+	return from_triplets(n, n, triplets);
+}
+
+static SparseMatrix<double> laplacian3d(int grid)
+{
+	const int n = grid * grid * grid;
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(n) * 7);
+	const int plane = grid * grid;
+	for (int i = 0; i < grid; ++i)
+	{
+		for (int j = 0; j < grid; ++j)
+		{
+			for (int l = 0; l < grid; ++l)
+			{
+				const int k = i * plane + j * grid + l;
+				triplets.emplace_back(k, k, 6.0);
+				if (i > 0) triplets.emplace_back(k, k - plane, -1.0);
+				if (i + 1 < grid) triplets.emplace_back(k, k + plane, -1.0);
+				if (j > 0) triplets.emplace_back(k, k - grid, -1.0);
+				if (j + 1 < grid) triplets.emplace_back(k, k + grid, -1.0);
+				if (l > 0) triplets.emplace_back(k, k - 1, -1.0);
+				if (l + 1 < grid) triplets.emplace_back(k, k + 1, -1.0);
+			}
+		}
+	}
+
+	return from_triplets(n, n, triplets);
+}
+
+// nonsymmetric, strictly diagonally dominant with `bandwidth` diagonals on each side.
+static SparseMatrix<double> banded(int n, int bandwidth)
+{
+	std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(n) * (2 * bandwidth + 1));
+	for (int j = 0; j < n; ++j)
+	{
+		for (int i = std::max(0, j - bandwidth); i <= std::min(n - 1, j + bandwidth); ++i)
+			triplets.emplace_back(i, j, i == j ? 2.0 * bandwidth + 1.0 : uniform(generator));
+	}
+
+	return from_triplets(n, n, triplets);
+}
+
+// graph Laplacian plus identity of a Chung-Lu graph with power-law expected degrees,
+// symmetric positive definite with a few very dense rows and columns.
+static SparseMatrix<double> power_law(int n, double averageDegree)
+{
+	std::vector<double> weights(n);
+	for (int i = 0; i < n; ++i)
+		weights[i] = std::pow(i + 1.0, -1.0 / 1.5);
+
+	std::discrete_distribution<int> endpoint(weights.begin(), weights.end());
+	const long long edges = static_cast<long long>(n * averageDegree / 2);
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(edges) * 4 + n);
+	std::vector<double> degree(n, 1.0);
+	for (long long e = 0; e < edges; ++e)
+	{
+		const int i = endpoint(generator);
+		const int j = endpoint(generator);
+		if (i == j)
+			continue;
+		triplets.emplace_back(i, j, -1.0);
+		triplets.emplace_back(j, i, -1.0);
+		degree[i] += 1.0;
+		degree[j] += 1.0;
+	}
+
+	for (int i = 0; i < n; ++i)
+		triplets.emplace_back(i, i, degree[i]);
+
+	return from_triplets(n, n, triplets);
+}
+
+// kernels
+
+static void bench_vectors()
+{
+	for (int n : sweep_for(options.scale).vectors)
+	{
+		VectorXd a = random_dense(n, 1), b = random_dense(n, 1), out(n);
+		VectorXf af = a.cast<float>(), bf = b.cast<float>(), outf(n);
+		const double d = sizeof(double), f = sizeof(float);
+		const std::string input = "random";
+
+		bench(make("ddot_", "dense-blas1", input, n, 1, 0, 2.0 * n, 2 * d * n), [&](Result&) { ddot_(a.data(), b.data(), n); });
+		bench(make("dadd_", "dense-blas1", input, n, 1, 0, n, 3 * d * n), [&](Result&) { dadd_(a.data(), b.data(), n, out.data()); });
+		bench(make("dscale_", "dense-blas1", input, n, 1, 0, n, 2 * d * n), [&](Result&) { dscale_(a.data(), 1.5, n, out.data()); });
+		// in place, with scalars that keep out and residual bounded over the repetitions.
+		VectorXd residual = b;
+		double squaredNorm;
+		bench(make("dvaxpy_", "dense-blas1", input, n, 1, 0, 2.0 * n, 3 * d * n), [&](Result&) { dvaxpy_(1e-3, a.data(), n, out.data()); });
+		bench(make("dvaxpby_", "dense-blas1", input, n, 1, 0, 3.0 * n, 3 * d * n), [&](Result&) { dvaxpby_(0.5, a.data(), 0.5, n, out.data()); });
+		bench(make("dvscal_", "dense-blas1", input, n, 1, 0, n, 2 * d * n), [&](Result&) { dvscal_(1.0, n, out.data()); });
+		bench(make("dvcopy_", "dense-blas1", input, n, 1, 0, 0, 2 * d * n), [&](Result&) { dvcopy_(a.data(), n, out.data()); });
+		bench(make("dvdot_squared_norm_", "dense-blas1", input, n, 1, 0, 4.0 * n, 2 * d * n), [&](Result&) { dvdot_squared_norm_(a.data(), b.data(), n, &squaredNorm); });
+		bench(make("dvcg_update_", "dense-blas1", input, n, 1, 0, 6.0 * n, 6 * d * n), [&](Result&) { dvcg_update_(1e-3, a.data(), b.data(), n, out.data(), residual.data()); });
+		bench(make("dvnorm_", "dense-blas1", input, n, 1, 0, 2.0 * n, d * n), [&](Result&) { dvnorm_(a.data(), n); });
+		bench(make("dvsquared_norm_", "dense-blas1", input, n, 1, 0, 2.0 * n, d * n), [&](Result&) { dvsquared_norm_(a.data(), n); });
+		bench(make("dvlp1_norm_", "dense-blas1", input, n, 1, 0, 2.0 * n, d * n), [&](Result&) { dvlp1_norm_(a.data(), n); });
+		bench(make("dvlpinf_norm_", "dense-blas1", input, n, 1, 0, 2.0 * n, d * n), [&](Result&) { dvlpinf_norm_(a.data(), n); });
+		bench(make("fdot_", "dense-blas1", input, n, 1, 0, 2.0 * n, 2 * f * n), [&](Result&) { fdot_(af.data(), bf.data(), n); });
+		bench(make("fadd_", "dense-blas1", input, n, 1, 0, n, 3 * f * n), [&](Result&) { fadd_(af.data(), bf.data(), n, outf.data()); });
+		bench(make("fscale_", "dense-blas1", input, n, 1, 0, n, 2 * f * n), [&](Result&) { fscale_(af.data(), 1.5f, n, outf.data()); });
+		bench(make("fvnorm_", "dense-blas1", input, n, 1, 0, 2.0 * n, f * n), [&](Result&) { fvnorm_(af.data(), n); });
+		bench(make("fvsquared_norm_", "dense-blas1", input, n, 1, 0, 2.0 * n, f * n), [&](Result&) { fvsquared_norm_(af.data(), n); });
+	}
+}
+
+static void bench_dense()
+{
+	const Sweep sweep = sweep_for(options.scale);
+	for (int n : sweep.dense)
+	{
+		MatrixXd a = random_dense(n, n), b = random_dense(n, n), spd = spd_dense(n), out(n, n);
+		MatrixXd out2(n, n), out3(n, n), out4(n, n);
+		MatrixXd tall = random_dense(2 * n, n);
+		VectorXd x = random_dense(n, 1), y(n), rhs = a * x, spdRhs = spd * x, tallRhs = random_dense(2 * n, 1), sv(n);
+		MatrixXd block = random_dense(n, 16), blockOut(n, 16);
+		MatrixXf af = a.cast<float>(), bf = b.cast<float>(), spdf = spd.cast<float>(), outf(n, n);
+		VectorXf xf = x.cast<float>(), yf(n), rhsf = rhs.cast<float>(), spdRhsf = spdRhs.cast<float>();
+		const double d = sizeof(double), f = sizeof(float), nn = static_cast<double>(n) * n, n3 = nn * n;
+		const char* blas = "dense-blas3";
+		const char* dec = "dense-decomposition";
+		const char* solve = "dense-solve";
+
+		bench(make("dmultv_", "dense-blas2", "random", n, n, 0, 2 * nn, d * (nn + 2.0 * n)), [&](Result&) { dmultv_(a.data(), n, n, x.data(), n, y.data()); });
+		bench(make("fmultv_", "dense-blas2", "random", n, n, 0, 2 * nn, f * (nn + 2.0 * n)), [&](Result&) { fmultv_(af.data(), n, n, xf.data(), n, yf.data()); });
+
+		bench(make("dmult_", blas, "random", n, n, 0, 2 * n3, 3 * d * nn), [&](Result&) { dmult_(a.data(), n, n, b.data(), n, n, out.data()); });
+		bench(make("dmultt_", blas, "random", n, n, 0, 2 * n3, 3 * d * nn), [&](Result&) { dmultt_(a.data(), n, n, b.data(), n, n, out.data()); });
+		// C = A^T B + C in place, C read and written.
+		bench(make("dgemm_", blas, "random", n, n, 0, 2 * n3 + nn, 4 * d * nn), [&](Result&) { dgemm_(a.data(), n, n, 1, b.data(), n, n, 0, 1.0, 1.0, out.data()); });
+		bench(make("da_multt_", blas, "random", n, n, 0, n3, 2 * d * nn), [&](Result&) { da_multt_(a.data(), n, n, out.data()); });
+		bench(make("da_tmult_", blas, "random", n, n, 0, n3, 2 * d * nn), [&](Result&) { da_tmult_(a.data(), n, n, out.data()); });
+		bench(make("fmult_", blas, "random", n, n, 0, 2 * n3, 3 * f * nn), [&](Result&) { fmult_(af.data(), n, n, bf.data(), n, n, outf.data()); });
+
+		const char* elementwise = "dense-elementwise";
+		bench(make("dminus_", elementwise, "random", n, n, 0, nn, 3 * d * nn), [&](Result&) { dminus_(a.data(), n, n, b.data(), n, n, out.data()); });
+		bench(make("dxplusa_", elementwise, "random", n, n, 0, nn, 3 * d * nn), [&](Result&) { dxplusa_(a.data(), n, n, b.data(), n, n, out.data()); });
+		bench(make("dxplusxt_", elementwise, "random", n, n, 0, nn, 2 * d * nn), [&](Result&) { dxplusxt_(a.data(), n, out.data()); });
+		bench(make("dtransp_", elementwise, "random", n, n, 0, 0, 2 * d * nn), [&](Result&) { dtransp_(a.data(), n, n, out.data()); });
+		bench(make("dtrace_", elementwise, "random", n, n, 0, n, d * n), [&](Result&) { dtrace_(a.data(), n, n); });
+		bench(make("dnorm_", elementwise, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dnorm_(a.data(), n, n); });
+		bench(make("dsquared_norm_", elementwise, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dsquared_norm_(a.data(), n, n); });
+		bench(make("dlp1_norm_", elementwise, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dlp1_norm_(a.data(), n, n); });
+		bench(make("dlpinf_norm_", elementwise, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dlpinf_norm_(a.data(), n, n); });
+		bench(make("fminus_", elementwise, "random", n, n, 0, nn, 3 * f * nn), [&](Result&) { fminus_(af.data(), n, n, bf.data(), n, n, outf.data()); });
+		bench(make("ftransp_", elementwise, "random", n, n, 0, 0, 2 * f * nn), [&](Result&) { ftransp_(af.data(), n, n, outf.data()); });
+		bench(make("ftrace_", elementwise, "random", n, n, 0, n, f * n), [&](Result&) { ftrace_(af.data(), n, n); });
+		bench(make("fnorm_", elementwise, "random", n, n, 0, 2 * nn, f * nn), [&](Result&) { fnorm_(af.data(), n, n); });
+
+		// LAPACK working notes operation counts for square matrices.
+		bench(make("dhouseholderQR_", dec, "random", n, n, 0, 4.0 / 3.0 * n3 + 4.0 / 3.0 * n3, 3 * d * nn), [&](Result&) { dhouseholderQR_(a.data(), n, n, out.data(), out2.data()); });
+		bench(make("dcolPivHouseholderQR_", dec, "random", n, n, 0, 8.0 / 3.0 * n3, 4 * d * nn), [&](Result&) { dcolPivHouseholderQR_(a.data(), n, n, out.data(), out2.data(), out3.data()); });
+		bench(make("dfullPivLU_", dec, "random", n, n, 0, 2.0 / 3.0 * n3, 5 * d * nn), [&](Result&) { dfullPivLU_(a.data(), n, n, out.data(), out2.data(), out3.data(), out4.data()); });
+		bench(make("ddeterminant_", dec, "random", n, n, 0, 2.0 / 3.0 * n3, d * nn), [&](Result&) { ddeterminant_(a.data(), n, n); });
+		bench(make("dinverse_", dec, "random", n, n, 0, 2 * n3, 2 * d * nn), [&](Result&) { dinverse_(a.data(), n, n, out.data()); });
+		bench(make("dselfadjoint_eigenvalues_", dec, "spd", n, n, 0, 9 * n3, 2 * d * nn), [&](Result&) { dselfadjoint_eigenvalues_(spd.data(), n, sv.data(), out.data()); });
+		bench(make("fdeterminant_", dec, "random", n, n, 0, 2.0 / 3.0 * n3, f * nn), [&](Result&) { fdeterminant_(af.data(), n, n); });
+		bench(make("finverse_", dec, "random", n, n, 0, 2 * n3, 2 * f * nn), [&](Result&) { finverse_(af.data(), n, n, outf.data()); });
+		bench(make("dsvd_bdcSvd_", dec, "random", n, n, 0, 21 * n3, 3 * d * nn), [&](Result&) { dsvd_bdcSvd_(a.data(), n, n, out.data(), sv.data(), out2.data()); });
+		bench(make("dsvd_bdcSvd__leastsquares_", solve, "random-tall", 2 * n, n, 0, 4.0 * 2 * nn * n + 22 * n3, d * 2 * nn), [&](Result&) { dsvd_bdcSvd__leastsquares_(tall.data(), 2 * n, n, tallRhs.data(), y.data()); });
+		// top n / 8 triplets with 10 oversamples and 2 power iterations, six passes over A.
+		const int svdRank = std::max(1, n / 8);
+		const double samples = std::min(svdRank + 10, n);
+		bench(make("dsvd_randomized_", dec, "random", n, n, 0, 12 * nn * samples, 6 * d * nn), [&](Result&) {
+			dsvd_randomized_(a.data(), n, n, svdRank, 10, 2, out.data(), sv.data(), out2.data());
+		});
+		if (n <= sweep.slowDense)
+		{
+			VectorXd imag(n);
+			bench(make("deigenvalues_", dec, "random", n, n, 0, 25 * n3, 3 * d * nn), [&](Result&) { deigenvalues_(a.data(), n, sv.data(), imag.data(), out.data(), out2.data()); });
+			bench(make("dsvd_", dec, "random", n, n, 0, 21 * n3, 3 * d * nn), [&](Result&) { dsvd_(a.data(), n, n, out.data(), sv.data(), out2.data()); });
+			bench(make("dsvd_leastsquares_", solve, "random-tall", 2 * n, n, 0, 4.0 * 2 * nn * n + 22 * n3, d * 2 * nn), [&](Result&) { dsvd_leastsquares_(tall.data(), 2 * n, n, tallRhs.data(), y.data()); });
+		}
+
+		bench(make("dsolve_partialPivLU_", solve, "random", n, n, 0, 2.0 / 3.0 * n3, d * nn), [&](Result&) { dsolve_partialPivLU_(a.data(), n, n, rhs.data(), y.data()); });
+		bench(make("dsolve_fullPivLu_", solve, "random", n, n, 0, 2.0 / 3.0 * n3, d * nn), [&](Result&) { dsolve_fullPivLu_(a.data(), n, n, rhs.data(), y.data()); });
+		bench(make("dsolve_colPivHouseholderQr_", solve, "random", n, n, 0, 4.0 / 3.0 * n3, d * nn), [&](Result&) { dsolve_colPivHouseholderQr_(a.data(), n, n, rhs.data(), y.data()); });
+		bench(make("dsolve_completeOrthogonalDecomposition_", solve, "random", n, n, 0, 4.0 / 3.0 * n3, d * nn), [&](Result&) { dsolve_completeOrthogonalDecomposition_(a.data(), n, n, rhs.data(), y.data()); });
+		bench(make("dsolve_llt_", solve, "spd", n, n, 0, n3 / 3.0, d * nn), [&](Result&) { dsolve_llt_(spd.data(), n, n, spdRhs.data(), y.data()); });
+		bench(make("dsolve_ldlt_", solve, "spd", n, n, 0, n3 / 3.0, d * nn), [&](Result&) { dsolve_ldlt_(spd.data(), n, n, spdRhs.data(), y.data()); });
+		bench(make("dnormal_equations__leastsquares_", solve, "random-tall", 2 * n, n, 0, 2.0 * nn * n + n3 / 3.0, d * 2 * nn), [&](Result&) { dnormal_equations__leastsquares_(tall.data(), 2 * n, n, tallRhs.data(), y.data()); });
+		bench(make("drelative_error_", solve, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { drelative_error_(a.data(), n, n, rhs.data(), x.data()); });
+		bench(make("dabsolute_error_", solve, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dabsolute_error_(a.data(), n, n, rhs.data(), x.data()); });
+		bench(make("dsolve_block_", solve, "random", n, n, 0, 2.0 / 3.0 * n3 + 2 * nn * 16, d * (nn + 32.0 * n)), [&](Result&) { dsolve_block_(PartialPivLUType, a.data(), n, n, block.data(), 16, blockOut.data()); });
+		bench(make("dsolve_mixedPrecision_", solve, "random", n, n, 0, 2.0 / 3.0 * n3, d * nn), [&](Result& r) {
+			dsolve_mixedPrecision_(MixedPartialPivLU, a.data(), n, n, rhs.data(), y.data(), &r.iterations);
+		});
+		bench(make("fsolve_partialPivLU_", solve, "random", n, n, 0, 2.0 / 3.0 * n3, f * nn), [&](Result&) { fsolve_partialPivLU_(af.data(), n, n, rhsf.data(), yf.data()); });
+		bench(make("fsolve_colPivHouseholderQr_", solve, "random", n, n, 0, 4.0 / 3.0 * n3, f * nn), [&](Result&) { fsolve_colPivHouseholderQr_(af.data(), n, n, rhsf.data(), yf.data()); });
+		bench(make("fsolve_llt_", solve, "spd", n, n, 0, n3 / 3.0, f * nn), [&](Result&) { fsolve_llt_(spdf.data(), n, n, spdRhsf.data(), yf.data()); });
+		bench(make("fsolve_ldlt_", solve, "spd", n, n, 0, n3 / 3.0, f * nn), [&](Result&) { fsolve_ldlt_(spdf.data(), n, n, spdRhsf.data(), yf.data()); });
+
+		// kept factorizations: create + compute + destroy, then the O(n^2) operations on one handle.
+		const char* kept = "dense-factorization";
+		bench(make("dfactorization_compute_", kept, "random", n, n, 0, 2.0 / 3.0 * n3, d * nn), [&](Result&) {
+			void* handle = dfactorization_create_(PartialPivLUType);
+			dfactorization_compute_(handle, a.data(), n, n);
+			dfactorization_destroy_(handle);
+		});
+		void* handle = dfactorization_create_(PartialPivLUType);
+		dfactorization_compute_(handle, a.data(), n, n);
+		bench(make("dfactorization_solve_", kept, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dfactorization_solve_(handle, rhs.data(), y.data()); });
+		bench(make("dfactorization_solveTranspose_", kept, "random", n, n, 0, 2 * nn, d * nn), [&](Result&) { dfactorization_solveTranspose_(handle, rhs.data(), y.data()); });
+		bench(make("dfactorization_solveBlock_", kept, "random", n, n, 0, 32 * nn, d * (nn + 32.0 * n)), [&](Result&) { dfactorization_solveBlock_(handle, block.data(), 16, blockOut.data()); });
+		bench(make("dfactorization_solveTransposeBlock_", kept, "random", n, n, 0, 32 * nn, d * (nn + 32.0 * n)), [&](Result&) { dfactorization_solveTransposeBlock_(handle, block.data(), 16, blockOut.data()); });
+		bench(make("dfactorization_determinant_", kept, "random", n, n, 0, n, d * n), [&](Result&) { dfactorization_determinant_(handle); });
+		bench(make("dfactorization_logAbsDeterminant_", kept, "random", n, n, 0, 2.0 * n, d * n), [&](Result&) { dfactorization_logAbsDeterminant_(handle); });
+		dfactorization_destroy_(handle);
+	}
+}
+
+static void bench_batches()
+{
+	const int count = sweep_for(options.scale).batch;
+	for (int size : { 3, 4, 8 })
+	{
+		const int elements = size * size;
+		MatrixXd a = random_dense(elements, count), b = random_dense(elements, count), out(elements, count);
+		for (int m = 0; m < count; ++m)
+			for (int i = 0; i < size; ++i)
+				a(i * size + i, m) += size;
+		MatrixXd rhs = random_dense(size, count), x(size, count), determinants(count, 1);
+		const double d = sizeof(double), s = size, c = count;
+		for (int layout : { 0, 1 })
+		{
+			const std::string input = layout == 0 ? "contiguous" : "interleaved";
+			bench(make("dbatch_mult_", "dense-batch", input, size, count, 0, c * 2 * s * s * s, c * 3 * d * s * s), [&](Result&) { dbatch_mult_(layout, size, count, a.data(), b.data(), out.data()); });
+			bench(make("dbatch_inverse_", "dense-batch", input, size, count, 0, c * 2 * s * s * s, c * 2 * d * s * s), [&](Result&) { dbatch_inverse_(layout, size, count, a.data(), out.data()); });
+			bench(make("dbatch_determinant_", "dense-batch", input, size, count, 0, c * 2.0 / 3.0 * s * s * s, c * d * s * s), [&](Result&) { dbatch_determinant_(layout, size, count, a.data(), determinants.data()); });
+			bench(make("dbatch_solve_", "dense-batch", input, size, count, 0, c * (2.0 / 3.0 * s * s * s + 2 * s * s), c * d * (s * s + 2 * s)), [&](Result&) { dbatch_solve_(layout, size, count, a.data(), rhs.data(), x.data()); });
+		}
+	}
+}
+
+struct SparseInput
+{
+	std::string name;
+	SparseMatrix<double> matrix;
+	bool symmetric;
+	bool direct;
+};
+
+static std::vector<SparseInput> sparse_inputs()
+{
+	const Sweep sweep = sweep_for(options.scale);
+	std::vector<SparseInput> inputs;
+	for (int grid : sweep.grids2d)
+		inputs.push_back({ "laplacian2d", laplacian2d(grid), true, true });
+	for (int grid : sweep.grids3d)
+		inputs.push_back({ "laplacian3d", laplacian3d(grid), true, true });
+	for (int n : sweep.graphs)
+	{
+		inputs.push_back({ "banded", banded(n, 8), false, true });
+		inputs.push_back({ "powerlaw", power_law(n, 8.0), true, n <= sweep.graphDirect });
+	}
+
+	return inputs;
+}
+
+// multiplications of the Gustavson product, one flop pair per entry of A(:, k) for every B(k, j).
+static double product_flops(const SparseMatrix<double>& a, const SparseMatrix<double>& b)
+{
+	double flops = 0.0;
+	for (int k = 0; k < b.nonZeros(); ++k)
+	{
+		const int column = b.innerIndexPtr()[k];
+		flops += 2.0 * (a.outerIndexPtr()[column + 1] - a.outerIndexPtr()[column]);
+	}
+
+	return flops;
+}
+
+// one-shot direct solves and a kept factorization, symmetric factorizations only on symmetric inputs.
+static void bench_sparse_direct(const SparseInput& input, int slowSparse)
+{
+	SparseMatrix<double> a = input.matrix;
+	const int n = static_cast<int>(a.rows());
+	const int nnz = static_cast<int>(a.nonZeros());
+	int* outer = a.outerIndexPtr();
+	int* inner = a.innerIndexPtr();
+	double* values = a.valuePtr();
+	SparseMatrix<float> af = a.cast<float>();
+	float* valuesf = af.valuePtr();
+	VectorXd y(n), rhs = a * VectorXd::Ones(n);
+	VectorXf yf(n), rhsf = rhs.cast<float>();
+	MatrixXd block = random_dense(n, 8), blockOut(n, 8);
+	const std::string& name = input.name;
+	const char* direct = "sparse-direct";
+
+	if (input.symmetric)
+	{
+		bench(make("ssolve_simplicialLLT_", direct, name, n, n, nnz), [&](Result&) { ssolve_simplicialLLT_(n, n, nnz, outer, inner, values, rhs.data(), n, y.data(), nullptr); });
+		bench(make("ssolve_simplicialLDLT_", direct, name, n, n, nnz), [&](Result&) { ssolve_simplicialLDLT_(n, n, nnz, outer, inner, values, rhs.data(), n, y.data(), nullptr); });
+		bench(make("sfsolve_simplicialLLT_", direct, name, n, n, nnz), [&](Result&) { sfsolve_simplicialLLT_(n, n, nnz, outer, inner, valuesf, rhsf.data(), n, yf.data(), nullptr); });
+		bench(make("sfsolve_simplicialLDLT_", direct, name, n, n, nnz), [&](Result&) { sfsolve_simplicialLDLT_(n, n, nnz, outer, inner, valuesf, rhsf.data(), n, yf.data(), nullptr); });
+	}
+
+	bench(make("ssolve_sparseLU_", direct, name, n, n, nnz), [&](Result&) { ssolve_sparseLU_(n, n, nnz, outer, inner, values, rhs.data(), n, y.data(), nullptr); });
+	bench(make("sfsolve_sparseLU_", direct, name, n, n, nnz), [&](Result&) { sfsolve_sparseLU_(n, n, nnz, outer, inner, valuesf, rhsf.data(), n, yf.data(), nullptr); });
+	bench(make("ssolve_mixedPrecision_", direct, name, n, n, nnz), [&](Result& r) {
+		ssolve_mixedPrecision_(input.symmetric ? MixedSimplicialLDLT : MixedSparseLU, n, n, nnz, outer, inner, values, rhs.data(), n, y.data(), &r.iterations);
+	});
+	bench(make("ssolve_block_", direct, name, n, n, nnz), [&](Result&) {
+		ssolve_block_(input.symmetric ? SimplicialLDLTType : SparseLUType, n, n, nnz, outer, inner, values, block.data(), 8, blockOut.data());
+	});
+	if (n <= slowSparse)
+	{
+		bench(make("ssolve_sparseQR_", direct, name, n, n, nnz), [&](Result&) { ssolve_sparseQR_(n, n, nnz, outer, inner, values, rhs.data(), n, y.data(), nullptr); });
+		bench(make("sfsolve_sparseQR_", direct, name, n, n, nnz), [&](Result&) { sfsolve_sparseQR_(n, n, nnz, outer, inner, valuesf, rhsf.data(), n, yf.data(), nullptr); });
+		bench(make("snormal_equations__leastsquares_sparselu_", direct, name, n, n, nnz), [&](Result&) {
+			snormal_equations__leastsquares_sparselu_(n, n, nnz, outer, inner, values, rhs.data(), n, y.data());
+		});
+	}
+
+	// kept factorization: symbolic analysis, numeric factorization, then solves on one handle.
+	const char* kept = "sparse-factorization";
+	const int type = input.symmetric ? SimplicialLDLTType : SparseLUType;
+	bench(make("sfactorization_analyzePattern_", kept, name, n, n, nnz), [&](Result&) {
+		void* handle = sfactorization_create_(type);
+		sfactorization_analyzePattern_(handle, n, n, nnz, outer, inner, values);
+		sfactorization_destroy_(handle);
+	});
+	void* handle = sfactorization_create_(type);
+	sfactorization_analyzePattern_(handle, n, n, nnz, outer, inner, values);
+	bench(make("sfactorization_factorize_", kept, name, n, n, nnz), [&](Result&) { sfactorization_factorize_(handle, n, n, nnz, outer, inner, values); });
+	bench(make("sfactorization_solve_", kept, name, n, n, nnz), [&](Result&) { sfactorization_solve_(handle, rhs.data(), n, y.data(), n); });
+	bench(make("sfactorization_solveBlock_", kept, name, n, n, nnz), [&](Result&) { sfactorization_solveBlock_(handle, block.data(), n, 8, blockOut.data(), n); });
+	sfactorization_destroy_(handle);
+
+	// partial eigensolver, the six eigenvalues nearest zero by shift-invert so the factorization
+	// dominates; iterations are the restarts.
+	const int k = std::min(6, n - 2);
+	if (k > 0)
+	{
+		std::vector<double> realValues(k), imagValues(k), realVectors(static_cast<size_t>(n) * k), imagVectors(static_cast<size_t>(n) * k);
+		bench(make("seigs_", "sparse-eigs", name, n, n, nnz), [&](Result& r) {
+			int symmetric, converged;
+			seigs_(n, n, nnz, outer, inner, values, k, 2, 0.0, -1, -1, -1.0,
+				realValues.data(), imagValues.data(), realVectors.data(), imagVectors.data(), &symmetric, &r.iterations, &converged);
+		});
+	}
+}
+
+static void bench_sparse_input(const SparseInput& input, int slowSparse)
+{
+	SparseMatrix<double> a = input.matrix;
+	const int n = static_cast<int>(a.rows());
+	const int nnz = static_cast<int>(a.nonZeros());
+	int* outer = a.outerIndexPtr();
+	int* inner = a.innerIndexPtr();
+	double* values = a.valuePtr();
+	SparseMatrix<float> af = a.cast<float>();
+	float* valuesf = af.valuePtr();
+	VectorXd x = VectorXd::Ones(n), y(n), rhs = a * x;
+	VectorXf xf = x.cast<float>(), yf(n), rhsf = rhs.cast<float>();
+	const double d = sizeof(double), f = sizeof(float), i4 = sizeof(int);
+	const double csc = nnz * (d + i4) + (n + 1.0) * i4, cscf = nnz * (f + i4) + (n + 1.0) * i4;
+	const char* ops = "sparse-ops";
+	const std::string& name = input.name;
+
+	// the same pattern shifted by one column, so sums and differences do not collapse to a.
+	std::vector<Triplet<double>> shifted;
+	for (int j = 0; j < n; ++j)
+		for (int k = outer[j]; k < outer[j + 1]; ++k)
+			shifted.emplace_back(inner[k], (j + 1) % n, values[k]);
+	SparseMatrix<double> b = from_triplets(n, n, shifted);
+	SparseMatrix<float> bf = b.cast<float>();
+
+	std::vector<int> outerOut(n + 1);
+	const int sumNnz = sadd_symbolic_(n, n, outer, inner, b.outerIndexPtr(), b.innerIndexPtr(), outerOut.data());
+	std::vector<int> innerSum(sumNnz);
+	std::vector<double> valuesSum(sumNnz);
+	std::vector<float> valuesSumf(sumNnz);
+	const double sumBytes = csc + b.nonZeros() * (d + i4) + sumNnz * (d + i4);
+
+	bench(make("smultv_", "sparse-spmv", name, n, n, nnz, 2.0 * nnz, csc + 2 * d * n), [&](Result&) { smultv_(n, n, nnz, outer, inner, values, x.data(), n, y.data()); });
+	bench(make("sfmultv_", "sparse-spmv", name, n, n, nnz, 2.0 * nnz, cscf + 2 * f * n), [&](Result&) { sfmultv_(n, n, nnz, outer, inner, valuesf, xf.data(), n, yf.data()); });
+	bench(make("smultv_create_", "sparse-spmv", name, n, n, nnz, 0, 2 * csc), [&](Result&) { smultv_destroy_(smultv_create_(n, n, nnz, outer, inner, values)); });
+	bench(make("smultv_createRowMajor_", "sparse-spmv", name, n, n, nnz, 0, 2 * csc), [&](Result&) { smultv_destroy_(smultv_createRowMajor_(n, n, nnz, outer, inner, values)); });
+	for (bool rowMajor : { false, true })
+	{
+		void* handle = rowMajor ? smultv_createRowMajor_(n, n, nnz, outer, inner, values) : smultv_create_(n, n, nnz, outer, inner, values);
+		bench(make("smultv_multiply_", "sparse-spmv", name + (rowMajor ? "-csr" : "-cached"), n, n, nnz, 2.0 * nnz, csc + 2 * d * n),
+			[&](Result&) { smultv_multiply_(handle, x.data(), y.data()); });
+		smultv_destroy_(handle);
+	}
+
+	bench(make("sadd_symbolic_", ops, name, n, n, nnz, 0, i4 * (2.0 * nnz + 3.0 * n)), [&](Result&) { sadd_symbolic_(n, n, outer, inner, b.outerIndexPtr(), b.innerIndexPtr(), outerOut.data()); });
+	bench(make("sadd_", ops, name, n, n, nnz, sumNnz, sumBytes), [&](Result&) {
+		sadd_(n, n, nnz, outer, inner, values, static_cast<int>(b.nonZeros()), b.outerIndexPtr(), b.innerIndexPtr(), b.valuePtr(), outerOut.data(), innerSum.data(), valuesSum.data());
+	});
+	bench(make("sminus_", ops, name, n, n, nnz, sumNnz, sumBytes), [&](Result&) {
+		sminus_(n, n, nnz, outer, inner, values, static_cast<int>(b.nonZeros()), b.outerIndexPtr(), b.innerIndexPtr(), b.valuePtr(), outerOut.data(), innerSum.data(), valuesSum.data());
+	});
+	bench(make("sfadd_", ops, name, n, n, nnz, sumNnz, sumBytes), [&](Result&) {
+		sfadd_(n, n, nnz, outer, inner, valuesf, static_cast<int>(bf.nonZeros()), bf.outerIndexPtr(), bf.innerIndexPtr(), bf.valuePtr(), outerOut.data(), innerSum.data(), valuesSumf.data());
+	});
+	bench(make("sfminus_", ops, name, n, n, nnz, sumNnz, sumBytes), [&](Result&) {
+		sfminus_(n, n, nnz, outer, inner, valuesf, static_cast<int>(bf.nonZeros()), bf.outerIndexPtr(), bf.innerIndexPtr(), bf.valuePtr(), outerOut.data(), innerSum.data(), valuesSumf.data());
+	});
+
+	std::vector<int> outerT(n + 1), innerT(nnz);
+	std::vector<double> valuesT(nnz);
+	std::vector<float> valuesTf(nnz);
+	bench(make("stranspose_", ops, name, n, n, nnz, 0, 2 * csc), [&](Result&) { stranspose_(n, n, nnz, outer, inner, values, outerT.data(), innerT.data(), valuesT.data()); });
+	bench(make("sftranspose_", ops, name, n, n, nnz, 0, 2 * cscf), [&](Result&) { sftranspose_(n, n, nnz, outer, inner, valuesf, outerT.data(), innerT.data(), valuesTf.data()); });
+	bench(make("snorm_", ops, name, n, n, nnz, 2.0 * nnz, d * nnz), [&](Result&) { snorm_(n, n, nnz, outer, inner, values); });
+	bench(make("ssquaredNorm_", ops, name, n, n, nnz, 2.0 * nnz, d * nnz), [&](Result&) { ssquaredNorm_(n, n, nnz, outer, inner, values); });
+	bench(make("sfnorm_", ops, name, n, n, nnz, 2.0 * nnz, f * nnz), [&](Result&) { sfnorm_(n, n, nnz, outer, inner, valuesf); });
+	bench(make("sfsquaredNorm_", ops, name, n, n, nnz, 2.0 * nnz, f * nnz), [&](Result&) { sfsquaredNorm_(n, n, nnz, outer, inner, valuesf); });
+	bench(make("srelative_error_", ops, name, n, n, nnz, 2.0 * nnz + 4.0 * n, csc + 2 * d * n), [&](Result&) { srelative_error_(n, n, nnz, outer, inner, values, rhs.data(), x.data()); });
+	bench(make("sabsolute_error_", ops, name, n, n, nnz, 2.0 * nnz + 3.0 * n, csc + 2 * d * n), [&](Result&) { sabsolute_error_(n, n, nnz, outer, inner, values, rhs.data(), x.data()); });
+
+	// triplets in column order with every entry split in two halves, so duplicates are summed.
+	std::vector<int> rowIndices, colIndices;
+	std::vector<double> tripletValues;
+	for (int j = 0; j < n; ++j)
+		for (int k = outer[j]; k < outer[j + 1]; ++k)
+			for (int half = 0; half < 2; ++half)
+			{
+				rowIndices.push_back(inner[k]);
+				colIndices.push_back(j);
+				tripletValues.push_back(0.5 * values[k]);
+			}
+	std::vector<float> tripletValuesf(tripletValues.begin(), tripletValues.end());
+	const int count = static_cast<int>(tripletValues.size());
+	std::vector<int> outerBuilt(n + 1), innerBuilt(count);
+	std::vector<double> valuesBuilt(count);
+	std::vector<float> valuesBuiltf(count);
+	bench(make("sfrom_triplets_", ops, name, n, n, nnz, 0, count * (d + 2 * i4) + csc), [&](Result&) {
+		sfrom_triplets_(n, n, count, rowIndices.data(), colIndices.data(), tripletValues.data(), outerBuilt.data(), innerBuilt.data(), valuesBuilt.data());
+	});
+	bench(make("sffrom_triplets_", ops, name, n, n, nnz, 0, count * (f + 2 * i4) + cscf), [&](Result&) {
+		sffrom_triplets_(n, n, count, rowIndices.data(), colIndices.data(), tripletValuesf.data(), outerBuilt.data(), innerBuilt.data(), valuesBuiltf.data());
+	});
+
+	// A * A, symbolic then numeric as SparseMatrixD.Mult does.
+	std::vector<int> outerProduct(n + 1);
+	const int productNnz = smult_symbolic_(n, n, n, outer, inner, outer, inner, outerProduct.data());
+	std::vector<int> innerProduct(productNnz);
+	std::vector<double> valuesProduct(productNnz);
+	const double productFlops = product_flops(a, a);
+	const double productBytes = 2 * csc + productNnz * (d + i4);
+	bench(make("smult_symbolic_", "sparse-spgemm", name, n, n, nnz, 0, 2 * csc), [&](Result&) { smult_symbolic_(n, n, n, outer, inner, outer, inner, outerProduct.data()); });
+	bench(make("smult_", "sparse-spgemm", name, n, n, nnz, productFlops, productBytes), [&](Result&) {
+		smult_(n, n, n, nnz, outer, inner, values, nnz, outer, inner, values, outerProduct.data(), innerProduct.data(), valuesProduct.data());
+	});
+	std::vector<int> outerPruned(n + 1);
+	bench(make("smult_pruned_", "sparse-spgemm", name, n, n, nnz, productFlops, productBytes), [&](Result&) {
+		smult_symbolic_(n, n, n, outer, inner, outer, inner, outerPruned.data());
+		smult_pruned_(n, n, n, nnz, outer, inner, values, nnz, outer, inner, values, 1e-3, outerPruned.data(), innerProduct.data(), valuesProduct.data());
+	});
+
+	// six largest singular triplets by Lanczos bidiagonalization, iterations are the restarts.
+	if (n <= slowSparse)
+	{
+		const int k = std::min(6, n);
+		std::vector<double> u(static_cast<size_t>(n) * k), sigma(k), v(static_cast<size_t>(n) * k);
+		bench(make("ssvds_", "sparse-svd", name, n, n, nnz), [&](Result& r) {
+			int converged;
+			ssvds_(n, n, nnz, outer, inner, values, k, -1, -1, -1.0, u.data(), sigma.data(), v.data(), &r.iterations, &converged);
+		});
+	}
+
+	if (input.direct)
+		bench_sparse_direct(input, slowSparse);
+
+	// iterative solvers to 1e-8 (1e-5 in float) with the default preconditioner and at most
+	// 1000 iterations, flops of the matrix-vector products only; CG and MINRES need symmetric
+	// matrices.
+	const char* iterative = "sparse-iterative";
+	const int maxIterations = std::min(2 * n, 1000);
+	struct Solver { const char* name; const char* namef; IterativeSolve solve; IterativeSolveF solvef; int type; bool symmetricOnly; };
+	const Solver solvers[] = {
+		{ "ssolve_conjugateGradient_", "sfsolve_conjugateGradient_", ssolve_conjugateGradient_, sfsolve_conjugateGradient_, ConjugateGradientType, true },
+		{ "ssolve_MINRES_", "sfsolve_MINRES_", ssolve_MINRES_, sfsolve_MINRES_, MINRESType, true },
+		{ "ssolve_biCGSTAB_", "sfsolve_biCGSTAB_", ssolve_biCGSTAB_, sfsolve_biCGSTAB_, BiCGSTABType, false },
+		{ "ssolve_GMRES_", "sfsolve_GMRES_", ssolve_GMRES_, sfsolve_GMRES_, GMRESType, false },
+		{ "ssolve_DGMRES_", nullptr, ssolve_DGMRES_, nullptr, DGMRESType, false },
+		{ "ssolve_LeastSquaresConjugateGradient_", "sfsolve_LeastSquaresConjugateGradient_", ssolve_LeastSquaresConjugateGradient_, sfsolve_LeastSquaresConjugateGradient_, LeastSquaresCGType, false },
+	};
+
+	for (const Solver& solver : solvers)
+	{
+		if (solver.symmetricOnly && !input.symmetric)
+			continue;
+
+		// LSCG works on A^T A, two products per iteration.
+		const double perIteration = (solver.type == LeastSquaresCGType ? 4.0 : 2.0) * nnz;
+		bench(make(solver.name, iterative, name, n, n, nnz), [&](Result& r) {
+			double error;
+			solver.solve(n, n, nnz, maxIterations, 1e-8, 0, 10, 1e-3, 0.0, outer, inner, values, rhs.data(), n, nullptr, y.data(), &r.iterations, &error, nullptr);
+			r.flops = perIteration * r.iterations;
+			r.bytes = csc * r.iterations;
+		});
+		if (solver.solvef != nullptr)
+		{
+			bench(make(solver.namef, iterative, name, n, n, nnz), [&](Result& r) {
+				double error;
+				solver.solvef(n, n, nnz, maxIterations, 1e-5, 0, 10, 1e-3, 0.0, outer, inner, valuesf, rhsf.data(), n, nullptr, yf.data(), &r.iterations, &error, nullptr);
+				r.flops = perIteration * r.iterations;
+				r.bytes = cscf * r.iterations;
+			});
+		}
+	}
+
+	// kept iterative solver: preconditioner setup once, then solves.
+	const char* keptIterative = "sparse-iterative-kept";
+	const int keptType = input.symmetric ? ConjugateGradientType : BiCGSTABType;
+	bench(make("siterative_compute_", keptIterative, name, n, n, nnz), [&](Result&) {
+		void* solver = siterative_create_(keptType, 0);
+		siterative_compute_(solver, n, n, nnz, outer, inner, values, 10, 1e-3, 0.0);
+		siterative_destroy_(solver);
+	});
+	void* solver = siterative_create_(keptType, 0);
+	siterative_compute_(solver, n, n, nnz, outer, inner, values, 10, 1e-3, 0.0);
+	bench(make("siterative_solve_", keptIterative, name, n, n, nnz), [&](Result& r) {
+		double error;
+		siterative_solve_(solver, maxIterations, 1e-8, rhs.data(), n, nullptr, y.data(), &r.iterations, &error, nullptr);
+		r.flops = 2.0 * nnz * r.iterations;
+		r.bytes = csc * r.iterations;
+	});
+	siterative_destroy_(solver);
+}
+
+static void bench_sparse()
+{
+	const int slowSparse = sweep_for(options.scale).slowSparse;
+	for (const SparseInput& input : sparse_inputs())
+		bench_sparse_input(input, slowSparse);
+}
+
+// file formats, bytes are the size of the file written.
+static void bench_files()
+{
+	namespace fs = std::filesystem;
+	const fs::path directory = fs::temp_directory_path();
+	const std::string mtx = (directory / "kernel_benchmark.mtx").string();
+	const std::string bin = (directory / "kernel_benchmark.bin").string();
+	const Sweep sweep = sweep_for(options.scale);
+
+	SparseMatrix<double> a = laplacian2d(sweep.grids2d.back());
+	const int n = static_cast<int>(a.rows());
+	const int nnz = static_cast<int>(a.nonZeros());
+	std::vector<int> outer(n + 1), inner(nnz);
+	std::vector<double> values(nnz);
+	const char* family = "file-io";
+
+	// the readers need their files even when --filter skips the writers.
+	smatrixmarket_write_(mtx.c_str(), n, n, nnz, a.outerIndexPtr(), a.innerIndexPtr(), a.valuePtr());
+	smatrixfile_write_(bin.c_str(), n, n, nnz, a.outerIndexPtr(), a.innerIndexPtr(), a.valuePtr());
+
+	bench(make("smatrixmarket_write_", family, "laplacian2d", n, n, nnz), [&](Result& r) {
+		smatrixmarket_write_(mtx.c_str(), n, n, nnz, a.outerIndexPtr(), a.innerIndexPtr(), a.valuePtr());
+		r.bytes = static_cast<double>(fs::file_size(mtx));
+	});
+	bench(make("matrixmarket_read_", family, "laplacian2d", n, n, nnz, 0, static_cast<double>(fs::file_size(mtx))), [&](Result&) {
+		void* handle = matrixmarket_read_(mtx.c_str());
+		int format, rows, cols, count;
+		if (matrixmarket_info_(handle, &format, &rows, &cols, &count) == 0)
+			matrixmarket_sparse_(handle, outer.data(), inner.data(), values.data());
+		matrixmarket_destroy_(handle);
+	});
+	bench(make("smatrixfile_write_", family, "laplacian2d", n, n, nnz), [&](Result& r) {
+		smatrixfile_write_(bin.c_str(), n, n, nnz, a.outerIndexPtr(), a.innerIndexPtr(), a.valuePtr());
+		r.bytes = static_cast<double>(fs::file_size(bin));
+	});
+	// open plus one pass over the values, the pages are touched as a product would.
+	bench(make("matrixfile_open_", family, "laplacian2d", n, n, nnz, 0, static_cast<double>(fs::file_size(bin))), [&](Result&) {
+		void* handle = matrixfile_open_(bin.c_str());
+		int kind, rows, cols, count;
+		if (matrixfile_info_(handle, &kind, &rows, &cols, &count) == 0)
+		{
+			const int* mappedOuter;
+			const int* mappedInner;
+			const double* mappedValues;
+			matrixfile_sparse_(handle, &mappedOuter, &mappedInner, &mappedValues);
+			volatile double sum = Map<const VectorXd>(mappedValues, count).sum();
+			(void)sum;
+		}
+		matrixfile_close_(handle);
+	});
+
+	const int size = sweep.dense.back();
+	MatrixXd dense = random_dense(size, size), denseOut(size, size);
+	dmatrixmarket_write_(mtx.c_str(), dense.data(), size, size);
+	dmatrixfile_write_(bin.c_str(), dense.data(), size, size);
+	bench(make("dmatrixmarket_write_", family, "random", size, size), [&](Result& r) {
+		dmatrixmarket_write_(mtx.c_str(), dense.data(), size, size);
+		r.bytes = static_cast<double>(fs::file_size(mtx));
+	});
+	bench(make("matrixmarket_dense_", family, "random", size, size, 0, 0, static_cast<double>(fs::file_size(mtx))), [&](Result&) {
+		void* handle = matrixmarket_read_(mtx.c_str());
+		int format, rows, cols, count;
+		if (matrixmarket_info_(handle, &format, &rows, &cols, &count) == 0)
+			matrixmarket_dense_(handle, denseOut.data());
+		matrixmarket_destroy_(handle);
+	});
+	bench(make("dmatrixfile_write_", family, "random", size, size), [&](Result& r) {
+		dmatrixfile_write_(bin.c_str(), dense.data(), size, size);
+		r.bytes = static_cast<double>(fs::file_size(bin));
+	});
+	bench(make("matrixfile_dense_", family, "random", size, size, 0, 0, static_cast<double>(fs::file_size(bin))), [&](Result&) {
+		void* handle = matrixfile_open_(bin.c_str());
+		int kind, rows, cols, count;
+		if (matrixfile_info_(handle, &kind, &rows, &cols, &count) == 0)
+		{
+			volatile double sum = Map<const VectorXd>(matrixfile_dense_(handle), static_cast<Index>(rows) * cols).sum();
+			(void)sum;
+		}
+		matrixfile_close_(handle);
+	});
+
+	fs::remove(mtx);
+	fs::remove(bin);
+}
+
+// report
+
+static std::string escape(const std::string& text)
+{
+	std::string escaped;
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+			escaped += '\\';
+		escaped += c;
+	}
+
+	return escaped;
+}
+
+static void write_rate(FILE* out, const char* name, double amount, double seconds)
+{
+	if (amount > 0.0 && seconds > 0.0)
+		std::fprintf(out, ", \"%s\": %.6g", name, amount / seconds * 1e-9);
+	else
+		std::fprintf(out, ", \"%s\": null", name);
+}
+
+static void write_json(FILE* out)
+{
+	std::fprintf(out, "{\n  \"benchmark\": \"eigen_core kernels\",\n  \"version\": 1,\n");
+	std::fprintf(out, "  \"scale\": \"%s\",\n  \"threads\": %d,\n  \"repetitions\": %d,\n", escape(options.scale).c_str(), get_num_threads_(), options.repetitions);
+	std::fprintf(out, "  \"simd\": \"%s\",\n  \"results\": [", escape(simd_instruction_sets_in_use_()).c_str());
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const Result& r = results[i];
+		std::fprintf(out, "%s\n    {\"kernel\": \"%s\", \"family\": \"%s\", \"input\": \"%s\", \"rows\": %lld, \"cols\": %lld, \"nnz\": %lld",
+			i == 0 ? "" : ",", r.kernel.c_str(), r.family.c_str(), r.input.c_str(), r.rows, r.cols, r.nnz);
+		std::fprintf(out, ", \"time_s\": %.6g, \"median_s\": %.6g", r.best, r.median);
+		write_rate(out, "gflops", r.flops, r.best);
+		write_rate(out, "gbs", r.bytes, r.best);
+		if (r.iterations >= 0)
+			std::fprintf(out, ", \"iterations\": %d", r.iterations);
+		std::fprintf(out, "}");
+	}
+
+	std::fprintf(out, "\n  ]\n}\n");
+}
+
+static bool parse_options(int argc, char** argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+		if (arg == "--scale" && hasValue)
+			options.scale = argv[++i];
+		else if (arg == "--filter" && hasValue)
+			options.filter = argv[++i];
+		else if (arg == "--output" && hasValue)
+			options.output = argv[++i];
+		else if (arg == "--repetitions" && hasValue)
+			options.repetitions = std::max(1, std::atoi(argv[++i]));
+		else if (arg == "--threads" && hasValue)
+			options.threads = std::atoi(argv[++i]);
+		else
+			return false;
+	}
+
+	return options.scale == "quick" || options.scale == "default" || options.scale == "large";
+}
+
+int main(int argc, char** argv)
+{
+	if (!parse_options(argc, argv))
+	{
+		std::fprintf(stderr, "usage: kernel_benchmark [--scale quick|default|large] [--filter text] [--repetitions n] [--threads n] [--output file]\n");
+		return 2;
+	}
+
+	set_num_threads_(options.threads);
+	bench_vectors();
+	bench_dense();
+	bench_batches();
+	bench_sparse();
+	bench_files();
+
+	FILE* out = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+	if (out == nullptr)
+	{
+		std::fprintf(stderr, "cannot write %s\n", options.output.c_str());
+		return 1;
+	}
+
+	write_json(out);
+	if (out != stdout)
+		std::fclose(out);
+	set_num_threads_(0);
+	return 0;
+}
@@ -0,0 +1,104 @@
+﻿// spgemm_benchmark.cpp : scaling of the two-phase Gustavson sparse-sparse product.
+//
+// usage: spgemm_benchmark [grid] [repetitions] [max threads]
+// The product is the square of the 5-point Laplacian of a grid x grid mesh (a graph power),
+// the default grid of 1000 gives 1M rows and about 13M nonzeros in the result.
+
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+	void set_num_threads_(int threads);
+	int get_num_threads_();
+	int smult_symbolic_(int row, int inner, int col, int* outerIndex1, int* innerIndex1, int* outerIndex2, int* innerIndex2, int* outerIndex);
+	void smult_(int row, int inner, int col, int nnz1, int* outerIndex1, int* innerIndex1, double* values1,
+		int nnz2, int* outerIndex2, int* innerIndex2, double* values2, int* outerIndex, int* innerIndex, double* values);
+}
+
+using namespace Eigen;
+
+static SparseMatrix<double> laplacian(int grid)
+{
+	const int n = grid * grid;
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(n) * 5);
+	for (int i = 0; i < grid; ++i)
+	{
+		for (int j = 0; j < grid; ++j)
+		{
+			const int k = i * grid + j;
+			triplets.emplace_back(k, k, 4.0);
+			if (i > 0) triplets.emplace_back(k, k - grid, -1.0);
+			if (i + 1 < grid) triplets.emplace_back(k, k + grid, -1.0);
+			if (j > 0) triplets.emplace_back(k, k - 1, -1.0);
+			if (j + 1 < grid) triplets.emplace_back(k, k + 1, -1.0);
+		}
+	}
+
+	SparseMatrix<double> matrix(n, n);
+	matrix.setFromTriplets(triplets.begin(), triplets.end());
+	matrix.makeCompressed();
+	return matrix;
+}
+
+template<typename Function>
+static double best_milliseconds(int repetitions, Function function)
+{
+	double best = 1e300;
+	for (int r = 0; r < repetitions; ++r)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		const auto stop = std::chrono::steady_clock::now();
+		best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+	}
+
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	const int grid = argc > 1 ? std::atoi(argv[1]) : 1000;
+	const int repetitions = argc > 2 ? std::atoi(argv[2]) : 5;
+	const int maxThreads = argc > 3 ? std::atoi(argv[3]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+	SparseMatrix<double> matrix = laplacian(grid);
+	const int n = static_cast<int>(matrix.rows());
+	const int nnz = static_cast<int>(matrix.nonZeros());
+	int* outer = matrix.outerIndexPtr();
+	int* inner = matrix.innerIndexPtr();
+	double* values = matrix.valuePtr();
+
+	std::vector<int> outerIndex(n + 1);
+	const int resultNnz = smult_symbolic_(n, n, n, outer, inner, outer, inner, outerIndex.data());
+	std::vector<int> innerIndex(resultNnz);
+	std::vector<double> resultValues(resultNnz);
+	std::printf("rows %d, nonzeros %d, product nonzeros %d\n", n, nnz, resultNnz);
+
+	const double eigen = best_milliseconds(repetitions, [&]() {
+		SparseMatrix<double> product = matrix * matrix;
+	});
+	std::printf("%-10s %8s %10.3f ms\n", "eigen", "-", eigen);
+
+	double single = 0.0;
+	for (int threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1)
+	{
+		set_num_threads_(threads);
+		const double time = best_milliseconds(repetitions, [&]() {
+			smult_symbolic_(n, n, n, outer, inner, outer, inner, outerIndex.data());
+			smult_(n, n, n, nnz, outer, inner, values, nnz, outer, inner, values, outerIndex.data(), innerIndex.data(), resultValues.data());
+		});
+		if (threads == 1)
+			single = time;
+		std::printf("%-10s %8d %10.3f ms %6.2fx %6.2fx eigen\n", "gustavson", get_num_threads_(), time, single / time, eigen / time);
+	}
+
+	set_num_threads_(0);
+	return 0;
+}
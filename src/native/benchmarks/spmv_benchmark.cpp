@@ -0,0 +1,101 @@
+﻿// spmv_benchmark.cpp : scaling of the cached CSR sparse matrix-vector product.
+//
+// usage: spmv_benchmark [grid] [repetitions] [max threads]
+// The matrix is the 5-point Laplacian of a grid x grid mesh, the default grid of
+// 1500 gives 2.25M rows and about 11.2M nonzeros.
+
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+	void set_num_threads_(int threads);
+	int get_num_threads_();
+	void smultv_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values, double* v1, int length, double* vout);
+	void* smultv_create_(int row, int col, int nnz, int* outerIndex, int* innerIndex, double* values);
+	void smultv_multiply_(void* handle, double* v1, double* vout);
+	void smultv_destroy_(void* handle);
+}
+
+using namespace Eigen;
+
+static SparseMatrix<double> laplacian(int grid)
+{
+	const int n = grid * grid;
+	std::vector<Triplet<double>> triplets;
+	triplets.reserve(static_cast<size_t>(n) * 5);
+	for (int i = 0; i < grid; ++i)
+	{
+		for (int j = 0; j < grid; ++j)
+		{
+			const int k = i * grid + j;
+			triplets.emplace_back(k, k, 4.0);
+			if (i > 0) triplets.emplace_back(k, k - grid, -1.0);
+			if (i + 1 < grid) triplets.emplace_back(k, k + grid, -1.0);
+			if (j > 0) triplets.emplace_back(k, k - 1, -1.0);
+			if (j + 1 < grid) triplets.emplace_back(k, k + 1, -1.0);
+		}
+	}
+
+	SparseMatrix<double> matrix(n, n);
+	matrix.setFromTriplets(triplets.begin(), triplets.end());
+	matrix.makeCompressed();
+	return matrix;
+}
+
+template<typename Function>
+static double best_milliseconds(int repetitions, Function function)
+{
+	double best = 1e300;
+	for (int r = 0; r < repetitions; ++r)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		const auto stop = std::chrono::steady_clock::now();
+		best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+	}
+
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	const int grid = argc > 1 ? std::atoi(argv[1]) : 1500;
+	const int repetitions = argc > 2 ? std::atoi(argv[2]) : 10;
+	const int maxThreads = argc > 3 ? std::atoi(argv[3]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+	SparseMatrix<double> matrix = laplacian(grid);
+	const int n = static_cast<int>(matrix.rows());
+	const int nnz = static_cast<int>(matrix.nonZeros());
+	VectorXd v = VectorXd::Ones(n);
+	VectorXd y(n);
+
+	// values + column indices + row pointers + x and y.
+	const double bytes = nnz * (sizeof(double) + sizeof(int)) + (n + 1.0) * sizeof(int) + 2.0 * n * sizeof(double);
+	std::printf("rows %d, nonzeros %d\n", n, nnz);
+
+	const double serial = best_milliseconds(repetitions, [&]() {
+		smultv_(n, n, nnz, matrix.outerIndexPtr(), matrix.innerIndexPtr(), matrix.valuePtr(), v.data(), n, y.data());
+	});
+	std::printf("%-10s %8s %10.3f ms %8.2f GB/s\n", "smultv_", "-", serial, bytes / serial * 1e-6);
+
+	void* handle = smultv_create_(n, n, nnz, matrix.outerIndexPtr(), matrix.innerIndexPtr(), matrix.valuePtr());
+	double single = 0.0;
+	for (int threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1)
+	{
+		set_num_threads_(threads);
+		const double time = best_milliseconds(repetitions, [&]() { smultv_multiply_(handle, v.data(), y.data()); });
+		if (threads == 1)
+			single = time;
+		std::printf("%-10s %8d %10.3f ms %8.2f GB/s %6.2fx\n", "csr", get_num_threads_(), time, bytes / time * 1e-6, single / time);
+	}
+
+	smultv_destroy_(handle);
+	set_num_threads_(0);
+	return 0;
+}
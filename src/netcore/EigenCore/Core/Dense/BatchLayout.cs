@@ -0,0 +1,19 @@
+﻿namespace EigenCore.Core.Dense
+{
+    /// <summary>
+    /// Storage of the matrices of a <see cref="MatrixBatchXD"/>.
+    /// </summary>
+    public enum BatchLayout
+    {
+        /// <summary>
+        /// Matrix n is stored column-major at n * Size * Size.
+        /// </summary>
+        Contiguous,
+
+        /// <summary>
+        /// Entry (i, j) of matrix n is stored at (j * Size + i) * Count + n, the native kernels
+        /// vectorize across the batch.
+        /// </summary>
+        Interleaved
+    }
+}
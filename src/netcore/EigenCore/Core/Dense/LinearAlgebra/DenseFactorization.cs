@@ -0,0 +1,106 @@
+﻿using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.Dense.LinearAlgebra
+{
+    /// <summary>
+    /// Native dense decomposition kept alive between solves.
+    /// The matrix is factorized once in O(n^3), every solve afterwards costs O(n^2).
+    /// </summary>
+    public class DenseFactorization : NativeHandle
+    {
+        public DenseSolverType Solver { get; }
+
+        public int Rows { get; }
+
+        public int Cols { get; }
+
+        /// <summary>
+        /// false if the matrix is singular, or not positive definite for LLT.
+        /// </summary>
+        public bool Success { get; }
+
+        /// <summary>
+        /// A x = b.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns></returns>
+        public VectorXD Solve(VectorXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Cols];
+            EigenDenseUtilities.FactorizationSolve(Handle, rhs.GetValues(), x);
+            return new VectorXD(x);
+        }
+
+        /// <summary>
+        /// A^T x = b.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns></returns>
+        public VectorXD SolveTranspose(VectorXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Rows];
+            EigenDenseUtilities.FactorizationSolveTranspose(Handle, rhs.GetValues(), x);
+            return new VectorXD(x);
+        }
+
+        /// <summary>
+        /// A X = B for every column of B.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns></returns>
+        public MatrixXD Solve(MatrixXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Cols * rhs.Cols];
+            EigenDenseUtilities.FactorizationSolveBlock(Handle, rhs.GetValues(), rhs.Cols, x);
+            return new MatrixXD(x, Cols, rhs.Cols);
+        }
+
+        /// <summary>
+        /// A^T X = B for every column of B.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns></returns>
+        public MatrixXD SolveTranspose(MatrixXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Rows * rhs.Cols];
+            EigenDenseUtilities.FactorizationSolveTransposeBlock(Handle, rhs.GetValues(), rhs.Cols, x);
+            return new MatrixXD(x, Rows, rhs.Cols);
+        }
+
+        public double Determinant()
+        {
+            ThrowIfDisposed();
+            return EigenDenseUtilities.FactorizationDeterminant(Handle);
+        }
+
+        /// <summary>
+        /// log|det(A)|, does not overflow for large matrices.
+        /// </summary>
+        /// <returns></returns>
+        public double LogAbsDeterminant()
+        {
+            ThrowIfDisposed();
+            return EigenDenseUtilities.FactorizationLogAbsDeterminant(Handle);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenDenseUtilities.FactorizationDestroy(handle);
+        }
+
+        internal DenseFactorization(MatrixXD matrix, DenseSolverType solver)
+            : base(EigenDenseUtilities.FactorizationCreate((int)solver))
+        {
+            Solver = solver;
+            Rows = matrix.Rows;
+            Cols = matrix.Cols;
+            Success = EigenDenseUtilities.FactorizationCompute(Handle, matrix.GetValues(), Rows, Cols);
+        }
+    }
+}
@@ -6,6 +6,17 @@
         LLT,
         LDLT,
         PartialPivLU,
-        FullPivLU
+        FullPivLU,
+        CompleteOrthogonalDecomposition,
+
+        /// <summary>
+        /// PartialPivLU factorized in single precision, refined to double accuracy.
+        /// </summary>
+        MixedPrecisionPartialPivLU,
+
+        /// <summary>
+        /// LLT factorized in single precision, refined to double accuracy.
+        /// </summary>
+        MixedPrecisionLLT
     }
 }
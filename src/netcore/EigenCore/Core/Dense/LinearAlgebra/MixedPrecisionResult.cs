@@ -0,0 +1,24 @@
+﻿namespace EigenCore.Core.Dense.LinearAlgebra
+{
+    public class MixedPrecisionResult
+    {
+        public VectorXD Result { get; }
+
+        /// <summary>
+        /// Refinement steps taken on top of the single precision solve.
+        /// </summary>
+        public int RefinementSteps { get; }
+
+        /// <summary>
+        /// False when refinement stalled and the system was solved with a double factorization.
+        /// </summary>
+        public bool Converged { get; }
+
+        public MixedPrecisionResult(VectorXD result, int refinementSteps, bool converged)
+        {
+            Result = result;
+            RefinementSteps = refinementSteps;
+            Converged = converged;
+        }
+    }
+}
@@ -3,6 +3,10 @@
     public enum SVDType
     {
         Jacobi,
-        BdcSvd
+        BdcSvd,
+        /// <summary>
+        /// Randomized range finder, see MatrixXD.RandomizedSVD for a truncated decomposition.
+        /// </summary>
+        Randomized
     }
 }
@@ -0,0 +1,132 @@
+﻿using EigenCore.Eigen;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace EigenCore.Core.Dense
+{
+    /// <summary>
+    /// Count square matrices of the same Size in a single buffer, every operation
+    /// is one native call for the whole batch. Sizes 2 to 6 use fixed-size kernels.
+    /// </summary>
+    public class MatrixBatchXD : VBufferDense<double>
+    {
+        public int Size { get; }
+
+        public int Count { get; }
+
+        public BatchLayout Layout { get; }
+
+        private void ThrowIfIncompatible(MatrixBatchXD other)
+        {
+            if (other.Size != Size || other.Count != Count || other.Layout != Layout)
+            {
+                throw new ArgumentException("Batches must have the same size, count and layout.", nameof(other));
+            }
+        }
+
+        public MatrixXD Get(int index)
+        {
+            double[] values = new double[Size * Size];
+            if (Layout == BatchLayout.Contiguous)
+            {
+                Array.Copy(_values, index * values.Length, values, 0, values.Length);
+            }
+            else
+            {
+                for (int e = 0; e < values.Length; e++)
+                {
+                    values[e] = _values[e * Count + index];
+                }
+            }
+
+            return new MatrixXD(values, Size, Size);
+        }
+
+        /// <summary>
+        /// Copy of the batch in the other layout.
+        /// </summary>
+        /// <param name="layout"></param>
+        /// <returns></returns>
+        public MatrixBatchXD ToLayout(BatchLayout layout)
+        {
+            if (layout == Layout)
+            {
+                return new MatrixBatchXD(_values.ToArray(), Size, Count, Layout);
+            }
+
+            // both layouts are the transpose of each other seen as (Size * Size) x Count matrices.
+            int rows = Layout == BatchLayout.Contiguous ? Size * Size : Count;
+            int cols = Layout == BatchLayout.Contiguous ? Count : Size * Size;
+            double[] values = new double[Length];
+            EigenDenseUtilities.Transpose(GetValues(), rows, cols, values);
+            return new MatrixBatchXD(values, Size, Count, layout);
+        }
+
+        public MatrixBatchXD Mult(MatrixBatchXD other)
+        {
+            ThrowIfIncompatible(other);
+            double[] values = new double[Length];
+            EigenDenseUtilities.BatchMult((int)Layout, Size, Count, GetValues(), other.GetValues(), values);
+            return new MatrixBatchXD(values, Size, Count, Layout);
+        }
+
+        public MatrixBatchXD Inverse()
+        {
+            double[] values = new double[Length];
+            EigenDenseUtilities.BatchInverse((int)Layout, Size, Count, GetValues(), values);
+            return new MatrixBatchXD(values, Size, Count, Layout);
+        }
+
+        /// <summary>
+        /// Determinant of every matrix.
+        /// </summary>
+        /// <returns></returns>
+        public VectorXD Determinant()
+        {
+            double[] values = new double[Count];
+            EigenDenseUtilities.BatchDeterminant((int)Layout, Size, Count, GetValues(), values);
+            return new VectorXD(values);
+        }
+
+        /// <summary>
+        /// A_n x_n = b_n with partial pivoting. Right-hand side n is column n of a Size x Count
+        /// matrix for contiguous batches and row n of a Count x Size matrix for interleaved batches.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns>the solutions, in the shape of rhs.</returns>
+        public MatrixXD Solve(MatrixXD rhs)
+        {
+            if (rhs.Length != Size * Count)
+            {
+                throw new ArgumentException($"Expected {Count} right-hand sides of length {Size}.", nameof(rhs));
+            }
+
+            double[] values = new double[rhs.Length];
+            EigenDenseUtilities.BatchSolve((int)Layout, Size, Count, GetValues(), rhs.GetValues(), values);
+            return new MatrixXD(values, rhs.Rows, rhs.Cols);
+        }
+
+        public MatrixBatchXD(double[] values, int size, int count, BatchLayout layout = BatchLayout.Contiguous)
+            : base(values)
+        {
+            if (values.Length != size * size * count)
+            {
+                throw new ArgumentException($"Expected {count} matrices of size {size}.", nameof(values));
+            }
+
+            Size = size;
+            Count = count;
+            Layout = layout;
+        }
+
+        /// <summary>
+        /// Contiguous batch of square matrices of the same size, see <see cref="ToLayout"/> to interleave it.
+        /// </summary>
+        /// <param name="matrices"></param>
+        public MatrixBatchXD(IReadOnlyList<MatrixXD> matrices)
+            : this(matrices.SelectMany(m => m.GetValues().ToArray()).ToArray(), matrices[0].Rows, matrices.Count)
+        {
+        }
+    }
+}
@@ -2,6 +2,7 @@
 using EigenCore.Core.Dense.LinearAlgebra;
 using EigenCore.Core.Shared;
 using EigenCore.Eigen;
+using System;
 using System.Linq;
 
 namespace EigenCore.Core.Dense
@@ -374,6 +375,33 @@ namespace EigenCore.Core.Dense
             return new MatrixXD(outMatrix, Rows, other.Cols);
         }
 
+        /// <summary>
+        /// this = alpha * op(a) * op(b) + beta * this in place, op(x) is x^T when its flag is set.
+        /// The product is accumulated straight into this matrix without a temporary or a new
+        /// result; beta = 0 overwrites this matrix, whatever it holds.
+        /// </summary>
+        /// <param name="a"></param>
+        /// <param name="b"></param>
+        /// <param name="alpha"></param>
+        /// <param name="beta"></param>
+        /// <param name="transposeA"></param>
+        /// <param name="transposeB"></param>
+        public void MultAdd(MatrixXD a, MatrixXD b, double alpha = 1, double beta = 1, bool transposeA = false, bool transposeB = false)
+        {
+            int rows = transposeA ? a.Cols : a.Rows;
+            int inner = transposeA ? a.Rows : a.Cols;
+            int innerB = transposeB ? b.Cols : b.Rows;
+            int cols = transposeB ? b.Rows : b.Cols;
+            if (inner != innerB || rows != Rows || cols != Cols)
+            {
+                throw new ArgumentException($"Expected op(a) * op(b) of size {Rows} x {Cols}, got {rows} x {inner} times {innerB} x {cols}.");
+            }
+
+            EigenDenseUtilities.Gemm(a.GetValues(), a.Rows, a.Cols, transposeA,
+                b.GetValues(), b.Rows, b.Cols, transposeB,
+                alpha, beta, _values);
+        }
+
         public VectorXD Mult(VectorXD other)
         {
             double[] outVector = new double[Rows];
@@ -427,28 +455,44 @@ namespace EigenCore.Core.Dense
         /// <returns></returns>
         public VectorXD Solve(VectorXD other, DenseSolverType denseSolverType = DenseSolverType.ColPivHouseholderQR)
         {
-            double[] vout = new double[Rows];
-            switch (denseSolverType)
-            {
-                case DenseSolverType.PartialPivLU:
-                    EigenDenseUtilities.SolvePartialPivLU(GetValues(), Rows, Cols, other.GetValues(), vout);
-                    break;
-                case DenseSolverType.FullPivLU:
-                    EigenDenseUtilities.SolveFullPivLU(GetValues(), Rows, Cols, other.GetValues(), vout);
-                    break;
-                case DenseSolverType.LDLT:
-                    EigenDenseUtilities.SolveLDLT(GetValues(), Rows, Cols, other.GetValues(), vout);
-                    break;
-                case DenseSolverType.LLT:
-                    EigenDenseUtilities.SolveLLT(GetValues(), Rows, Cols, other.GetValues(), vout);
-                    break;
-                case DenseSolverType.ColPivHouseholderQR:
-                default:
-                    EigenDenseUtilities.SolveColPivHouseholderQr(GetValues(), Rows, Cols, other.GetValues(), vout);
-                    break;
-            }
+            return Solve(GetValues(), Rows, Cols, other, denseSolverType);
+        }
 
-            return new VectorXD(vout);
+        /// <summary>
+        /// A X = B for every column of B, the matrix is factorized once in a single native call.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="denseSolverType"></param>
+        /// <returns></returns>
+        public MatrixXD Solve(MatrixXD other, DenseSolverType denseSolverType = DenseSolverType.ColPivHouseholderQR)
+        {
+            double[] vout = new double[Cols * other.Cols];
+            EigenDenseUtilities.SolveBlock((int)denseSolverType, GetValues(), Rows, Cols, other.GetValues(), other.Cols, vout);
+            return new MatrixXD(vout, Cols, other.Cols);
+        }
+
+        /// <summary>
+        /// Factorizes the matrix once, the returned factorization serves many O(n^2) solves.
+        /// Mixed precision types are factorized in double.
+        /// </summary>
+        /// <param name="denseSolverType"></param>
+        /// <returns></returns>
+        public DenseFactorization Factorize(DenseSolverType denseSolverType = DenseSolverType.ColPivHouseholderQR)
+        {
+            return new DenseFactorization(this, denseSolverType);
+        }
+
+        /// <summary>
+        /// Factorizes in single precision and refines the solution in double until it reaches double accuracy,
+        /// falls back to the double factorization when refinement stalls. LLT and MixedPrecisionLLT use LLT,
+        /// any other type PartialPivLU.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="denseSolverType"></param>
+        /// <returns></returns>
+        public MixedPrecisionResult SolveMixedPrecision(VectorXD other, DenseSolverType denseSolverType = DenseSolverType.MixedPrecisionPartialPivLU)
+        {
+            return SolveMixedPrecision(GetValues(), Rows, Cols, other, denseSolverType);
         }
 
         public double Determinant()
@@ -496,6 +540,11 @@ namespace EigenCore.Core.Dense
             double[] sout = new double[minRowsCols];
             double[] vout = new double[Cols * minRowsCols];
 
+            if (svdType == SVDType.Randomized)
+            {
+                return RandomizedSVD(minRowsCols);
+            }
+
             if (svdType == SVDType.Jacobi)
             {
                 EigenDenseUtilities.SVD(GetValues(), Rows, Cols, uout, sout, vout);
@@ -510,6 +559,45 @@ namespace EigenCore.Core.Dense
                 new MatrixXD(vout, Cols, minRowsCols));
         }
 
+        /// <summary>
+        /// Truncated SVD of the leading rank singular triplets by a randomized range finder:
+        /// A is sampled with rank + oversampling random vectors, refined by powerIterations
+        /// passes of A * A^T, and the small projected matrix is decomposed exactly. Costs
+        /// O(Rows * Cols * (rank + oversampling)) instead of the full decomposition; raise
+        /// powerIterations when the singular values decay slowly.
+        /// </summary>
+        /// <param name="rank"></param>
+        /// <param name="oversampling"></param>
+        /// <param name="powerIterations"></param>
+        /// <returns></returns>
+        public SVDResult RandomizedSVD(int rank, int oversampling = 10, int powerIterations = 2)
+        {
+            int minRowsCols = Cols < Rows ? Cols : Rows;
+            if (rank < 1 || rank > minRowsCols)
+            {
+                throw new ArgumentOutOfRangeException(nameof(rank), $"Rank must be between 1 and {minRowsCols}.");
+            }
+
+            if (oversampling < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(oversampling));
+            }
+
+            if (powerIterations < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(powerIterations));
+            }
+
+            double[] uout = new double[Rows * rank];
+            double[] sout = new double[rank];
+            double[] vout = new double[Cols * rank];
+            EigenDenseUtilities.SVDRandomized(GetValues(), Rows, Cols, rank, oversampling, powerIterations, uout, sout, vout);
+
+            return new SVDResult(new MatrixXD(uout, Rows, rank),
+                new VectorXD(sout),
+                new MatrixXD(vout, Cols, rank));
+        }
+
         /// <summary>
         /// X = A + A^T;
         /// </summary>
@@ -565,6 +653,10 @@ namespace EigenCore.Core.Dense
             {
                 EigenDenseUtilities.SVDLeastSquares(GetValues(), Rows, Cols, rhs.GetValues(), vout);
             }
+            else if (svdType == SVDType.Randomized)
+            {
+                throw new ArgumentException("Least squares needs the full SVD, use Jacobi or BdcSvd.", nameof(svdType));
+            }
             else
             {
                 EigenDenseUtilities.SVDLeastSquaresBdcSvd(GetValues(), Rows, Cols, rhs.GetValues(), vout);
@@ -663,6 +755,46 @@ namespace EigenCore.Core.Dense
         {
         }
 
+        internal static VectorXD Solve(ReadOnlySpan<double> values, int rows, int cols, VectorXD other, DenseSolverType denseSolverType)
+        {
+            double[] vout = new double[rows];
+            switch (denseSolverType)
+            {
+                case DenseSolverType.PartialPivLU:
+                    EigenDenseUtilities.SolvePartialPivLU(values, rows, cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.FullPivLU:
+                    EigenDenseUtilities.SolveFullPivLU(values, rows, cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.LDLT:
+                    EigenDenseUtilities.SolveLDLT(values, rows, cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.LLT:
+                    EigenDenseUtilities.SolveLLT(values, rows, cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.CompleteOrthogonalDecomposition:
+                    vout = new double[cols];
+                    EigenDenseUtilities.SolveCompleteOrthogonalDecomposition(values, rows, cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.MixedPrecisionPartialPivLU:
+                case DenseSolverType.MixedPrecisionLLT:
+                    return SolveMixedPrecision(values, rows, cols, other, denseSolverType).Result;
+                case DenseSolverType.ColPivHouseholderQR:
+                default:
+                    EigenDenseUtilities.SolveColPivHouseholderQr(values, rows, cols, other.GetValues(), vout);
+                    break;
+            }
+
+            return new VectorXD(vout);
+        }
+
+        internal static MixedPrecisionResult SolveMixedPrecision(ReadOnlySpan<double> values, int rows, int cols, VectorXD other, DenseSolverType denseSolverType)
+        {
+            double[] vout = new double[cols];
+            bool converged = EigenDenseUtilities.SolveMixedPrecision((int)denseSolverType, values, rows, cols, other.GetValues(), vout, out int steps);
+            return new MixedPrecisionResult(new VectorXD(vout), steps, converged);
+        }
+
         public MatrixXD(double[][] inputValues) :
             base(() => JaggedToFlatColumnWise(inputValues),
             JaggedRowsAndColsInfo(inputValues).Item1,
@@ -0,0 +1,221 @@
+﻿using EigenCore.Core.Dense.LinearAlgebra;
+using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+using System.Linq;
+
+namespace EigenCore.Core.Dense
+{
+    /// <summary>
+    /// Single precision dense matrix, half the memory and bandwidth of <see cref="MatrixXD"/>.
+    /// </summary>
+    public class MatrixXF : MatrixDenseBase<float>
+    {
+        private bool IsEqual(MatrixXF other)
+        {
+            if (Rows != other.Rows || Cols != other.Cols)
+            {
+                return false;
+            }
+
+            return ArrayHelpers.ArraysEqual(_values, other._values);
+        }
+
+        public static MatrixXF Zeros(int rows, int cols)
+        {
+            return new MatrixXF(new float[rows * cols], rows, cols);
+        }
+
+        public static MatrixXF Ones(int rows, int cols)
+        {
+            var values = new float[rows * cols];
+            values.Populate(1.0f);
+            return new MatrixXF(values, rows, cols);
+        }
+
+        public static MatrixXF Random(int rows, int cols, float min = 0, float max = 1, int seed = 0)
+        {
+            float[] input = new float[rows * cols];
+            float maxMinusMin = max - min;
+
+            if (_random == null) SetRandomState(seed);
+
+            for (int i = 0; i < rows * cols; i++)
+            {
+                input[i] = maxMinusMin * (float)_random.NextDouble() + min;
+            }
+
+            return new MatrixXF(input, rows, cols);
+        }
+
+        public static MatrixXF Identity(int size)
+        {
+            float[] input = new float[size * size];
+
+            for (int i = 0; i < size; i++)
+            {
+                input[i * (size + 1)] = 1.0f;
+            }
+
+            return new MatrixXF(input, size, size);
+        }
+
+        public float Max() => _values.AsParallel().Max();
+
+        public float Min() => _values.AsParallel().Min();
+
+        public float Sum() => _values.AsParallel().Sum();
+
+        public float Norm()
+        {
+            return EigenDenseUtilities.Norm(GetValues(), Rows, Cols);
+        }
+
+        public float Trace()
+        {
+            return EigenDenseUtilities.Trace(GetValues(), Rows, Cols);
+        }
+
+        public MatrixXF Plus(MatrixXF other)
+        {
+            float[] outMatrix = new float[Rows * Cols];
+            EigenDenseUtilities.Add(GetValues(), other.GetValues(), Length, outMatrix);
+            return new MatrixXF(outMatrix, Rows, Cols);
+        }
+
+        public MatrixXF Minus(MatrixXF other)
+        {
+            float[] outMatrix = new float[Rows * other.Cols];
+            EigenDenseUtilities.Minus(GetValues(), Rows, Cols, other.GetValues(), other.Rows, other.Cols, outMatrix);
+            return new MatrixXF(outMatrix, Rows, other.Cols);
+        }
+
+        public MatrixXF Mult(MatrixXF other)
+        {
+            float[] outMatrix = new float[Rows * other.Cols];
+            EigenDenseUtilities.Mult(GetValues(), Rows, Cols, other.GetValues(), other.Rows, other.Cols, outMatrix);
+            return new MatrixXF(outMatrix, Rows, other.Cols);
+        }
+
+        public VectorXF Mult(VectorXF other)
+        {
+            float[] outVector = new float[Rows];
+            EigenDenseUtilities.Mult(GetValues(), Rows, Cols, other.GetValues(), other.Length, outVector);
+            return new VectorXF(outVector);
+        }
+
+        public MatrixXF Transpose()
+        {
+            float[] outMatrix = new float[Rows * Cols];
+            EigenDenseUtilities.Transpose(GetValues(), Rows, Cols, outMatrix);
+            return new MatrixXF(outMatrix, Cols, Rows);
+        }
+
+        public float Determinant()
+        {
+            return EigenDenseUtilities.Determinant(GetValues(), Rows, Cols);
+        }
+
+        public MatrixXF Inverse()
+        {
+            float[] vout = new float[Rows * Cols];
+            EigenDenseUtilities.Inverse(GetValues(), Rows, Cols, vout);
+            return new MatrixXF(vout, Rows, Cols);
+        }
+
+        /// <summary>
+        /// Single precision counterpart of <see cref="MatrixXD.Solve(VectorXD, DenseSolverType)"/>, only
+        /// ColPivHouseholderQR, PartialPivLU, LLT and LDLT are available.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="denseSolverType"></param>
+        /// <returns></returns>
+        public VectorXF Solve(VectorXF other, DenseSolverType denseSolverType = DenseSolverType.ColPivHouseholderQR)
+        {
+            float[] vout = new float[Rows];
+            switch (denseSolverType)
+            {
+                case DenseSolverType.PartialPivLU:
+                    EigenDenseUtilities.SolvePartialPivLU(GetValues(), Rows, Cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.LDLT:
+                    EigenDenseUtilities.SolveLDLT(GetValues(), Rows, Cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.LLT:
+                    EigenDenseUtilities.SolveLLT(GetValues(), Rows, Cols, other.GetValues(), vout);
+                    break;
+                case DenseSolverType.ColPivHouseholderQR:
+                    EigenDenseUtilities.SolveColPivHouseholderQr(GetValues(), Rows, Cols, other.GetValues(), vout);
+                    break;
+                default:
+                    throw new NotSupportedException($"{denseSolverType} has no single precision solve.");
+            }
+
+            return new VectorXF(vout);
+        }
+
+        public MatrixXD ToDouble()
+        {
+            return new MatrixXD(_values.Select(v => (double)v).ToArray(), Rows, Cols);
+        }
+
+        public override MatrixXF Clone()
+        {
+            return new MatrixXF(_values.ToArray(), Rows, Cols);
+        }
+
+        public override bool Equals(object value)
+        {
+            if (ReferenceEquals(null, value))
+            {
+                return false;
+            }
+
+            if (ReferenceEquals(this, value))
+            {
+                return true;
+            }
+
+            if (value.GetType() != GetType())
+            {
+                return false;
+            }
+
+            return IsEqual((MatrixXF)value);
+        }
+
+        public override int GetHashCode()
+        {
+            return base.GetHashCode();
+        }
+
+        internal MatrixXF(float[] values, int rows, int cols)
+            : base(values, rows, cols)
+        {
+        }
+
+        public MatrixXF(float[][] inputValues) :
+            base(() => JaggedToFlatColumnWise(inputValues),
+            JaggedRowsAndColsInfo(inputValues).Item1,
+            JaggedRowsAndColsInfo(inputValues).Item2)
+        {
+        }
+
+        public MatrixXF(float[,] inputValues) :
+            base(() => MultyDimToFlatColumnWise(inputValues),
+            MultDimRowsAndColsInfo(inputValues).Item1,
+            MultDimRowsAndColsInfo(inputValues).Item2)
+        {
+        }
+
+        public MatrixXF(MatrixXD matrix)
+            : base(matrix.GetValues().ToArray().Select(v => (float)v).ToArray(), matrix.Rows, matrix.Cols)
+        {
+        }
+
+        public MatrixXF(string valuesString)
+            : base(valuesString, (string value) => float.Parse(value))
+        {
+        }
+    }
+}
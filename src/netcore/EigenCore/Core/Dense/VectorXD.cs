@@ -113,7 +113,79 @@ namespace EigenCore.Core.Dense
 
         public void ScaleInplace(double scalar)
         {
-            ArrayHelpers.ArraysScaleInplace(_values, scalar);
+            EigenDenseUtilities.Scal(scalar, Length, _values);
+        }
+
+        /// <summary>
+        /// this += alpha * other (axpy) in place, nothing is allocated.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="alpha"></param>
+        public void AddInplace(VectorXD other, double alpha = 1)
+        {
+            CheckLength(other);
+            EigenDenseUtilities.Axpy(alpha, other.GetValues(), Length, _values);
+        }
+
+        /// <summary>
+        /// this = alpha * other + beta * this (axpby) in place.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="alpha"></param>
+        /// <param name="beta"></param>
+        public void AddInplace(VectorXD other, double alpha, double beta)
+        {
+            CheckLength(other);
+            EigenDenseUtilities.Axpby(alpha, other.GetValues(), beta, Length, _values);
+        }
+
+        /// <summary>
+        /// this -= other in place.
+        /// </summary>
+        /// <param name="other"></param>
+        public void MinusInplace(VectorXD other)
+        {
+            AddInplace(other, -1);
+        }
+
+        /// <summary>
+        /// Overwrites this vector with the values of other.
+        /// </summary>
+        /// <param name="other"></param>
+        public void CopyFrom(VectorXD other)
+        {
+            CheckLength(other);
+            EigenDenseUtilities.Copy(other.GetValues(), Length, _values);
+        }
+
+        /// <summary>
+        /// this . other and this . this in a single pass over both vectors.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <returns></returns>
+        public (double Dot, double SquaredNorm) DotSquaredNorm(VectorXD other)
+        {
+            CheckLength(other);
+            double dot = EigenDenseUtilities.DotSquaredNorm(GetValues(), other.GetValues(), Length, out double squaredNorm);
+            return (dot, squaredNorm);
+        }
+
+        /// <summary>
+        /// The fused conjugate gradient update x += alpha * p, r -= alpha * q with q = A p,
+        /// in place and in a single pass; returns the new r . r.
+        /// </summary>
+        /// <param name="x"></param>
+        /// <param name="r"></param>
+        /// <param name="alpha"></param>
+        /// <param name="p"></param>
+        /// <param name="q"></param>
+        /// <returns></returns>
+        public static double ConjugateGradientUpdate(VectorXD x, VectorXD r, double alpha, VectorXD p, VectorXD q)
+        {
+            x.CheckLength(r);
+            x.CheckLength(p);
+            x.CheckLength(q);
+            return EigenDenseUtilities.ConjugateGradientUpdate(alpha, p.GetValues(), q.GetValues(), x.Length, x._values, r._values);
         }
 
         public VectorXD Scale(double scalar)
@@ -123,6 +195,14 @@ namespace EigenCore.Core.Dense
             return new VectorXD(outVector);
         }
 
+        private void CheckLength(VectorXD other)
+        {
+            if (other.Length != Length)
+            {
+                throw new ArgumentException($"Expected a vector of length {Length}, got {other.Length}.", nameof(other));
+            }
+        }
+
         public override bool Equals(object value)
         {
             if (ReferenceEquals(null, value))
@@ -0,0 +1,128 @@
+﻿using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System.Linq;
+
+namespace EigenCore.Core.Dense
+{
+    /// <summary>
+    /// Single precision dense vector, half the memory and bandwidth of <see cref="VectorXD"/>.
+    /// </summary>
+    public class VectorXF : VectorDenseBase<float>
+    {
+        private bool IsEqual(VectorXF other)
+        {
+            if (Length != other.Length)
+            {
+                return false;
+            }
+
+            return ArrayHelpers.ArraysEqual(_values, other._values);
+        }
+
+        public static VectorXF Zeros(int size)
+        {
+            return new VectorXF(new float[size]);
+        }
+
+        public static VectorXF Ones(int size)
+        {
+            var values = new float[size];
+            values.Populate(1.0f);
+            return new VectorXF(values);
+        }
+
+        public static VectorXF Random(int size, float min = 0, float max = 1, int seed = 0)
+        {
+            float[] input = new float[size];
+            float maxMinusMin = max - min;
+
+            if (_random == null) SetRandomState(seed);
+
+            for (int i = 0; i < size; i++)
+            {
+                input[i] = maxMinusMin * (float)_random.NextDouble() + min;
+            }
+
+            return new VectorXF(input);
+        }
+
+        public float Max() => _values.AsParallel().Max();
+
+        public float Min() => _values.AsParallel().Min();
+
+        public float Sum() => _values.AsParallel().Sum();
+
+        public float Dot(VectorXF other)
+        {
+            return EigenDenseUtilities.Dot(GetValues(), other.GetValues(), Length);
+        }
+
+        public float Norm()
+        {
+            return EigenDenseUtilities.Norm(GetValues(), Length);
+        }
+
+        public float SquaredNorm()
+        {
+            return EigenDenseUtilities.SquaredNorm(GetValues(), Length);
+        }
+
+        public VectorXF Add(VectorXF other)
+        {
+            float[] outVector = new float[Length];
+            EigenDenseUtilities.Add(GetValues(), other.GetValues(), Length, outVector);
+            return new VectorXF(outVector);
+        }
+
+        public VectorXF Scale(float scalar)
+        {
+            float[] outVector = new float[Length];
+            EigenDenseUtilities.Scale(GetValues(), scalar, Length, outVector);
+            return new VectorXF(outVector);
+        }
+
+        public VectorXD ToDouble()
+        {
+            return new VectorXD(_values.Select(v => (double)v).ToArray());
+        }
+
+        public override bool Equals(object value)
+        {
+            if (ReferenceEquals(null, value))
+            {
+                return false;
+            }
+
+            if (ReferenceEquals(this, value))
+            {
+                return true;
+            }
+
+            if (value.GetType() != GetType())
+            {
+                return false;
+            }
+
+            return IsEqual((VectorXF)value);
+        }
+
+        public override int GetHashCode()
+        {
+            return base.GetHashCode();
+        }
+
+        public VectorXF(string valuesString)
+            : base(valuesString, (string value) => float.Parse(value))
+        {
+        }
+
+        public VectorXF(VectorXD vector)
+            : base(vector.GetValues().ToArray().Select(v => (float)v).ToArray())
+        {
+        }
+
+        public VectorXF(float[] values) : base(values)
+        {
+        }
+    }
+}
@@ -0,0 +1,64 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.LinearAlgebra;
+using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.IO
+{
+    /// <summary>
+    /// Read-only column-major matrix over a memory-mapped file. Products and solves pass
+    /// the mapped array straight to the native library; spans are valid until Dispose.
+    /// </summary>
+    public class MappedMatrixXD : NativeHandle
+    {
+        private readonly IntPtr _values;
+
+        public int Rows { get; }
+
+        public int Cols { get; }
+
+        internal MappedMatrixXD(IntPtr handle, int rows, int cols)
+            : base(handle)
+        {
+            Rows = rows;
+            Cols = cols;
+            _values = EigenSharedUtilities.MatrixFileDense(handle);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenSharedUtilities.MatrixFileClose(handle);
+        }
+
+        public ReadOnlySpan<double> GetValues()
+        {
+            ThrowIfDisposed();
+            unsafe
+            {
+                return new ReadOnlySpan<double>((void*)_values, Rows * Cols);
+            }
+        }
+
+        public VectorXD Mult(VectorXD other)
+        {
+            double[] outVector = new double[Rows];
+            EigenDenseUtilities.Mult(GetValues(), Rows, Cols, other.GetValues(), other.Length, outVector);
+            return new VectorXD(outVector);
+        }
+
+        public VectorXD Solve(VectorXD other, DenseSolverType denseSolverType = DenseSolverType.ColPivHouseholderQR)
+        {
+            return MatrixXD.Solve(GetValues(), Rows, Cols, other, denseSolverType);
+        }
+
+        /// <summary>
+        /// Copies the mapped array into a matrix that outlives the file.
+        /// </summary>
+        /// <returns></returns>
+        public MatrixXD ToMatrixXD()
+        {
+            return new MatrixXD(GetValues().ToArray(), Rows, Cols);
+        }
+    }
+}
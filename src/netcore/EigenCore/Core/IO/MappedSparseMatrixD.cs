@@ -0,0 +1,110 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using EigenCore.Core.Sparse;
+using EigenCore.Core.Sparse.LinearAlgebra;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.IO
+{
+    /// <summary>
+    /// Read-only compressed column matrix over a memory-mapped file. Products and solves pass
+    /// the mapped arrays straight to the native library; spans are valid until Dispose.
+    /// </summary>
+    public class MappedSparseMatrixD : NativeHandle
+    {
+        private readonly IntPtr _outerStarts;
+        private readonly IntPtr _innerIndices;
+        private readonly IntPtr _values;
+
+        public int Rows { get; }
+
+        public int Cols { get; }
+
+        public int Nnz { get; }
+
+        internal MappedSparseMatrixD(IntPtr handle, int rows, int cols, int nnz)
+            : base(handle)
+        {
+            Rows = rows;
+            Cols = cols;
+            Nnz = nnz;
+            EigenSharedUtilities.MatrixFileSparse(handle, out _outerStarts, out _innerIndices, out _values);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenSharedUtilities.MatrixFileClose(handle);
+        }
+
+        public ReadOnlySpan<int> GetOuterStarts()
+        {
+            ThrowIfDisposed();
+            unsafe
+            {
+                return new ReadOnlySpan<int>((void*)_outerStarts, Cols + 1);
+            }
+        }
+
+        public ReadOnlySpan<int> GetInnerIndices()
+        {
+            ThrowIfDisposed();
+            unsafe
+            {
+                return new ReadOnlySpan<int>((void*)_innerIndices, Nnz);
+            }
+        }
+
+        public ReadOnlySpan<double> GetValues()
+        {
+            ThrowIfDisposed();
+            unsafe
+            {
+                return new ReadOnlySpan<double>((void*)_values, Nnz);
+            }
+        }
+
+        public VectorXD Mult(VectorXD other)
+        {
+            double[] values = new double[Rows];
+            EigenSparseUtilities.Mult(Rows, Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, values);
+            return new VectorXD(values);
+        }
+
+        public IterativeSolverResult IterativeSolve(VectorXD other, IterativeSolverInfo iterativeSolverInfo = default(IterativeSolverInfo))
+        {
+            return SparseMatrixD.IterativeSolve(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, iterativeSolverInfo);
+        }
+
+        public VectorXD DirectSolve(VectorXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            return SparseMatrixD.DirectSolve(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, directSolverType);
+        }
+
+        public DirectSolverResult DirectSolveWithStats(VectorXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            return SparseMatrixD.DirectSolveWithStats(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, directSolverType);
+        }
+
+        public SparseEigenSolverResult Eigs(int k, EigenvalueSelection which = EigenvalueSelection.Largest, double sigma = 0,
+            int subspaceSize = -1, int maxRestarts = -1, double tolerance = -1)
+        {
+            return SparseMatrixD.Eigs(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), k, which, sigma, subspaceSize, maxRestarts, tolerance);
+        }
+
+        public SparseSVDResult Svds(int k, int subspaceSize = -1, int maxRestarts = -1, double tolerance = -1)
+        {
+            return SparseMatrixD.Svds(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), k, subspaceSize, maxRestarts, tolerance);
+        }
+
+        /// <summary>
+        /// Copies the mapped arrays into a matrix that outlives the file.
+        /// </summary>
+        /// <returns></returns>
+        public SparseMatrixD ToSparseMatrixD()
+        {
+            return new SparseMatrixD(GetValues().ToArray(), GetInnerIndices().ToArray(), GetOuterStarts().ToArray(), Rows, Cols);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Sparse;
+using EigenCore.Eigen;
+using System;
+using System.IO;
+
+namespace EigenCore.Core.IO
+{
+    /// <summary>
+    /// Versioned binary matrix files: a 64-byte header followed by 64-byte aligned
+    /// column-major sections. Opening memory-maps the file, the returned views use the
+    /// mapped arrays directly, so loading costs nothing until the data is touched.
+    /// </summary>
+    public static class MatrixFile
+    {
+        // must match MatrixFileKind and MatrixFileStatus in EigenNative.cpp.
+        internal const int Sparse = 0;
+        internal const int Dense = 1;
+        private const int Ok = 0;
+        private const int IOError = 1;
+
+        /// <summary>
+        /// Writes a sparse matrix file.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="matrix"></param>
+        public static void Write(string path, SparseMatrixD matrix)
+        {
+            if (!EigenSharedUtilities.MatrixFileWrite(path, matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues()))
+            {
+                throw new IOException($"Could not write {path}.");
+            }
+        }
+
+        /// <summary>
+        /// Writes a dense matrix file.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="matrix"></param>
+        public static void Write(string path, MatrixXD matrix)
+        {
+            if (!EigenSharedUtilities.MatrixFileWrite(path, matrix.GetValues(), matrix.Rows, matrix.Cols))
+            {
+                throw new IOException($"Could not write {path}.");
+            }
+        }
+
+        /// <summary>
+        /// Maps a sparse matrix file, the view must be disposed to unmap it.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static MappedSparseMatrixD OpenSparse(string path)
+        {
+            IntPtr handle = Open(path, Sparse, out int rows, out int cols, out int nnz);
+            return new MappedSparseMatrixD(handle, rows, cols, nnz);
+        }
+
+        /// <summary>
+        /// Maps a dense matrix file, the view must be disposed to unmap it.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static MappedMatrixXD OpenDense(string path)
+        {
+            IntPtr handle = Open(path, Dense, out int rows, out int cols, out _);
+            return new MappedMatrixXD(handle, rows, cols);
+        }
+
+        private static IntPtr Open(string path, int expectedKind, out int rows, out int cols, out int nnz)
+        {
+            IntPtr handle = EigenSharedUtilities.MatrixFileOpen(path);
+            int status = EigenSharedUtilities.MatrixFileInfo(handle, out int kind, out rows, out cols, out nnz);
+            if (status == Ok && kind == expectedKind)
+            {
+                return handle;
+            }
+
+            string error = status == Ok ? (kind == Sparse ? "sparse" : "dense") + " matrix" : EigenSharedUtilities.MatrixFileError(handle);
+            EigenSharedUtilities.MatrixFileClose(handle);
+            if (status == IOError)
+            {
+                throw new IOException($"Could not read {path}: {error}.");
+            }
+
+            throw new InvalidDataException($"Invalid matrix file {path}: {error}.");
+        }
+    }
+}
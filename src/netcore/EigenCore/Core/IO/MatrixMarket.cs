@@ -0,0 +1,119 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Sparse;
+using EigenCore.Eigen;
+using System;
+using System.IO;
+
+namespace EigenCore.Core.IO
+{
+    /// <summary>
+    /// Matrix Market (.mtx) files read and written by the native library. Coordinate and array
+    /// files with real, integer or pattern fields and general, symmetric or skew-symmetric
+    /// storage are supported; files are memory-mapped and parsed on the thread budget.
+    /// </summary>
+    public static class MatrixMarket
+    {
+        // must match MatrixMarketFormat and MatrixMarketStatus in EigenNative.cpp.
+        private const int Coordinate = 0;
+        private const int Ok = 0;
+        private const int IOError = 1;
+
+        /// <summary>
+        /// Reads a file as a sparse matrix, array files are converted.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static SparseMatrixD ReadSparse(string path)
+        {
+            IntPtr handle = Read(path, out int format, out int rows, out int cols, out int nnz);
+            try
+            {
+                if (format != Coordinate)
+                {
+                    return ReadDense(handle, rows, cols).ToSparse();
+                }
+
+                int[] outerStarts = new int[cols + 1];
+                int[] innerIndices = new int[nnz];
+                double[] values = new double[nnz];
+                EigenSharedUtilities.MatrixMarketSparse(handle, outerStarts, innerIndices, values);
+                return new SparseMatrixD(values, innerIndices, outerStarts, rows, cols);
+            }
+            finally
+            {
+                EigenSharedUtilities.MatrixMarketDestroy(handle);
+            }
+        }
+
+        /// <summary>
+        /// Reads a file as a dense matrix, coordinate files are expanded.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static MatrixXD ReadDense(string path)
+        {
+            IntPtr handle = Read(path, out _, out int rows, out int cols, out _);
+            try
+            {
+                return ReadDense(handle, rows, cols);
+            }
+            finally
+            {
+                EigenSharedUtilities.MatrixMarketDestroy(handle);
+            }
+        }
+
+        /// <summary>
+        /// Writes a coordinate real general file.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="matrix"></param>
+        public static void Write(string path, SparseMatrixD matrix)
+        {
+            if (!EigenSharedUtilities.MatrixMarketWrite(path, matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues()))
+            {
+                throw new IOException($"Could not write {path}.");
+            }
+        }
+
+        /// <summary>
+        /// Writes an array real general file.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="matrix"></param>
+        public static void Write(string path, MatrixXD matrix)
+        {
+            if (!EigenSharedUtilities.MatrixMarketWrite(path, matrix.GetValues(), matrix.Rows, matrix.Cols))
+            {
+                throw new IOException($"Could not write {path}.");
+            }
+        }
+
+        private static IntPtr Read(string path, out int format, out int rows, out int cols, out int nnz)
+        {
+            IntPtr handle = EigenSharedUtilities.MatrixMarketRead(path);
+            int status = EigenSharedUtilities.MatrixMarketInfo(handle, out format, out rows, out cols, out nnz);
+            if (status == Ok)
+            {
+                return handle;
+            }
+
+            string error = EigenSharedUtilities.MatrixMarketError(handle);
+            EigenSharedUtilities.MatrixMarketDestroy(handle);
+            if (status == IOError)
+            {
+                throw new IOException($"Could not read {path}: {error}.");
+            }
+
+            throw new InvalidDataException($"Invalid Matrix Market file {path}: {error}.");
+        }
+
+        private static MatrixXD ReadDense(IntPtr handle, int rows, int cols)
+        {
+            double[] values = new double[rows * cols];
+            EigenSharedUtilities.MatrixMarketDense(handle, values);
+            return new MatrixXD(values, rows, cols);
+        }
+    }
+}
@@ -6,6 +6,8 @@ namespace EigenCore.Core.Shared
     {
         private const double DoubleTolerance = 10e-12;
 
+        private const float FloatTolerance = 10e-6f;
+
         internal static void Populate<T>(this T[] arr, T value)
         {
             for (int i = 0; i < arr.Length; i++)
@@ -135,5 +137,23 @@ namespace EigenCore.Core.Shared
 
             return false;
         }
+
+        internal static bool ArraysEqual(float[] array1, float[] array2)
+        {
+            if (array1.Length == array2.Length)
+            {
+                for (int i = 0; i < array1.Length; i++)
+                {
+                    if (Math.Abs(array1[i] - array2[i]) > FloatTolerance)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            return false;
+        }
     }
 }
@@ -0,0 +1,18 @@
+﻿namespace EigenCore.Core.Shared
+{
+    /// <summary>
+    /// Outcome of a native decomposition, mirrors Eigen::ComputationInfo.
+    /// </summary>
+    public enum ComputationInfo
+    {
+        Success,
+
+        /// <summary>
+        /// The matrix does not satisfy the requirements of the decomposition, e.g. it is
+        /// singular for SparseLU or not positive definite for SimplicialLLT.
+        /// </summary>
+        NumericalIssue,
+        NoConvergence,
+        InvalidInput
+    }
+}
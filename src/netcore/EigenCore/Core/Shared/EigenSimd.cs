@@ -0,0 +1,15 @@
+﻿using EigenCore.Eigen;
+
+namespace EigenCore.Core.Shared
+{
+    /// <summary>
+    /// Instruction sets of the native library picked at load time.
+    /// </summary>
+    public static class EigenSimd
+    {
+        /// <summary>
+        /// Instruction sets Eigen vectorizes with, e.g. "AVX2, AVX, SSE, SSE2, SSE3, SSSE3, SSE4.1, SSE4.2".
+        /// </summary>
+        public static string InstructionSetsInUse => EigenSharedUtilities.SimdInstructionSetsInUse();
+    }
+}
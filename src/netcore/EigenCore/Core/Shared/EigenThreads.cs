@@ -0,0 +1,60 @@
+﻿using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.Shared
+{
+    /// <summary>
+    /// Controls how many threads the native library uses for products and decompositions.
+    /// Has no effect when the native library was built without OpenMP.
+    /// </summary>
+    public static class EigenThreads
+    {
+        /// <summary>
+        /// Process-wide number of threads, a value &lt;= 0 restores the OpenMP default.
+        /// Reading returns the number of threads a call from the current thread will use.
+        /// </summary>
+        public static int NumThreads
+        {
+            get => EigenSharedUtilities.GetNumThreads();
+            set => EigenSharedUtilities.SetNumThreads(value);
+        }
+
+        /// <summary>
+        /// Overrides the number of threads for calls made from the current OS thread
+        /// until the returned scope is disposed, e.g. to keep small requests single-threaded.
+        /// </summary>
+        public static ThreadBudget Budget(int threads)
+        {
+            if (threads <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(threads), "Thread budget must be positive.");
+            }
+
+            return new ThreadBudget(threads);
+        }
+    }
+
+    /// <summary>
+    /// Thread budget scope returned by <see cref="EigenThreads.Budget(int)"/>, restores the previous budget on Dispose.
+    /// </summary>
+    public sealed class ThreadBudget : IDisposable
+    {
+        private readonly int _previous;
+        private bool _disposed;
+
+        internal ThreadBudget(int threads)
+        {
+            _previous = EigenSharedUtilities.GetThreadBudget();
+            EigenSharedUtilities.SetThreadBudget(threads);
+        }
+
+        public void Dispose()
+        {
+            if (!_disposed)
+            {
+                EigenSharedUtilities.SetThreadBudget(_previous);
+                _disposed = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,50 @@
+﻿using System;
+
+namespace EigenCore.Core.Shared
+{
+    /// <summary>
+    /// Owns an object allocated by the native library and releases it
+    /// on Dispose or, as a last resort, on finalization.
+    /// </summary>
+    public abstract class NativeHandle : IDisposable
+    {
+        protected IntPtr Handle { get; private set; }
+
+        public bool IsDisposed => Handle == IntPtr.Zero;
+
+        protected NativeHandle(IntPtr handle)
+        {
+            Handle = handle;
+        }
+
+        protected abstract void ReleaseHandle(IntPtr handle);
+
+        protected void ThrowIfDisposed()
+        {
+            if (IsDisposed)
+            {
+                throw new ObjectDisposedException(GetType().Name);
+            }
+        }
+
+        protected virtual void Dispose(bool disposing)
+        {
+            if (!IsDisposed)
+            {
+                ReleaseHandle(Handle);
+                Handle = IntPtr.Zero;
+            }
+        }
+
+        public void Dispose()
+        {
+            Dispose(true);
+            GC.SuppressFinalize(this);
+        }
+
+        ~NativeHandle()
+        {
+            Dispose(false);
+        }
+    }
+}
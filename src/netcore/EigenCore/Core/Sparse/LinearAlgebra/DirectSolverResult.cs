@@ -0,0 +1,24 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    public class DirectSolverResult
+    {
+        public DirectSolverResult(VectorXD result, DirectSolverStats stats, DirectSolverType solver)
+        {
+            Result = result;
+            Stats = stats;
+            Solver = solver;
+        }
+
+        /// <summary>
+        /// False when the factorization failed, e.g. NumericalIssue for a singular or indefinite matrix;
+        /// <see cref="Result"/> is zero in that case.
+        /// </summary>
+        public bool Success => Stats.Info == ComputationInfo.Success;
+        public VectorXD Result { get; }
+        public DirectSolverStats Stats { get; }
+        public DirectSolverType Solver { get; }
+    }
+}
@@ -0,0 +1,67 @@
+﻿using EigenCore.Core.Shared;
+using System;
+using System.Runtime.InteropServices;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Phase timing and fill-in of a sparse direct solve, filled by the native library
+    /// (must match SparseDirectStats in EigenNative.cpp).
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct DirectSolverStats
+    {
+        private readonly int _info;
+        private readonly int _ordering;
+        private readonly double _orderingSeconds;
+        private readonly double _symbolicSeconds;
+        private readonly double _numericSeconds;
+        private readonly double _solveSeconds;
+        private readonly long _nnzL;
+        private readonly long _nnzU;
+        private readonly long _workspaceBytes;
+
+        public ComputationInfo Info => (ComputationInfo)_info;
+
+        public SparseOrdering Ordering => (SparseOrdering)_ordering;
+
+        public TimeSpan OrderingTime => FromSeconds(_orderingSeconds);
+
+        /// <summary>
+        /// Symbolic analysis after the ordering (elimination tree, column counts). SparseLU
+        /// runs its symbolic factorization interleaved with the numeric one, counted in <see cref="NumericTime"/>.
+        /// </summary>
+        public TimeSpan SymbolicTime => FromSeconds(_symbolicSeconds);
+
+        public TimeSpan NumericTime => FromSeconds(_numericSeconds);
+
+        /// <summary>
+        /// Triangular solves, zero when the factorization failed.
+        /// </summary>
+        public TimeSpan SolveTime => FromSeconds(_solveSeconds);
+
+        public TimeSpan TotalTime => FromSeconds(_orderingSeconds + _symbolicSeconds + _numericSeconds + _solveSeconds);
+
+        /// <summary>
+        /// Nonzeros of L including its diagonal; for SparseQR the nonzeros of the Householder vectors of Q.
+        /// Zero when the factorization failed.
+        /// </summary>
+        public long NnzL => _nnzL;
+
+        /// <summary>
+        /// Nonzeros of U, equal to <see cref="NnzL"/> for the Cholesky solvers; for SparseQR the nonzeros of R.
+        /// </summary>
+        public long NnzU => _nnzU;
+
+        /// <summary>
+        /// Bytes of the factors as allocated, the permuted copy of the matrix and the work vectors
+        /// of the factorization, the scratch space of the ordering is not included.
+        /// </summary>
+        public long WorkspaceBytes => _workspaceBytes;
+
+        private static TimeSpan FromSeconds(double seconds)
+        {
+            return TimeSpan.FromTicks((long)(seconds * TimeSpan.TicksPerSecond));
+        }
+    }
+}
@@ -5,6 +5,16 @@
         SimplicialLLT,
         SimplicialLDLT,
         SparseLU,
-        SparseQR
+        SparseQR,
+
+        /// <summary>
+        /// SparseLU factorized in single precision, refined to double accuracy.
+        /// </summary>
+        MixedPrecisionSparseLU,
+
+        /// <summary>
+        /// SimplicialLDLT factorized in single precision, refined to double accuracy.
+        /// </summary>
+        MixedPrecisionSimplicialLDLT
     }
 }
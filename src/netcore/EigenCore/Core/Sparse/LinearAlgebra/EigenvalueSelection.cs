@@ -0,0 +1,24 @@
+﻿namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Eigenvalues returned by <see cref="SparseMatrixD.Eigs"/>.
+    /// </summary>
+    public enum EigenvalueSelection
+    {
+        /// <summary>
+        /// Largest first, by real part for a nonsymmetric matrix.
+        /// </summary>
+        Largest,
+
+        /// <summary>
+        /// Smallest first, by real part for a nonsymmetric matrix. Interior or clustered eigenvalues
+        /// converge slowly, <see cref="NearestSigma"/> is usually much faster.
+        /// </summary>
+        Smallest,
+
+        /// <summary>
+        /// Nearest sigma first, by shift-invert: A - sigma I is factorized once and must not be singular.
+        /// </summary>
+        NearestSigma
+    }
+}
@@ -1,4 +1,7 @@
-﻿namespace EigenCore.Core.Sparse.LinearAlgebra
+﻿using EigenCore.Core.Dense;
+using System;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
 {
     public class IterativeSolverInfo
     {
@@ -6,11 +9,66 @@
         public int MaxIterations { get; }
         public double Tolerance { get; }
 
-        public IterativeSolverInfo(IterativeSolverType solver = IterativeSolverType.ConjugateGradient, int maxIterations = -1, double tolerance = -1)
+        /// <summary>
+        /// Starting point of the iterations (warm start), x = 0 when null.
+        /// </summary>
+        public VectorXD InitialGuess { get; }
+        public bool HasInitialGuess => InitialGuess != null;
+
+        /// <summary>
+        /// LeastSquaresConjugateGradient works on A^T A and uses its diagonal
+        /// for the incomplete factorizations.
+        /// </summary>
+        public PreconditionerType Preconditioner { get; }
+
+        /// <summary>
+        /// IncompleteLUT fill factor, Eigen's default when &lt;= 0.
+        /// </summary>
+        public int FillFactor { get; }
+
+        /// <summary>
+        /// IncompleteLUT drop tolerance, Eigen's default when &lt;= 0.
+        /// </summary>
+        public double DropTolerance { get; }
+
+        /// <summary>
+        /// IncompleteCholesky initial diagonal shift, Eigen's default when &lt;= 0.
+        /// </summary>
+        public double Shift { get; }
+
+        /// <summary>
+        /// Records the relative residual |b - A x| / |b| every <see cref="ProgressInterval"/> iterations
+        /// in <see cref="IterativeSolverResult.ResidualHistory"/>, each record costs a matrix-vector product.
+        /// </summary>
+        public bool RecordHistory { get; }
+
+        /// <summary>
+        /// Iterations between two records or progress calls. GMRES only updates its iterate
+        /// at a restart and reports at the first restart after each interval.
+        /// </summary>
+        public int ProgressInterval { get; }
+
+        /// <summary>
+        /// Called with the iteration and the relative residual every <see cref="ProgressInterval"/>
+        /// iterations; returning false stops the solve, which keeps its last iterate and fails.
+        /// </summary>
+        public Func<int, double, bool> Progress { get; }
+
+        public IterativeSolverInfo(IterativeSolverType solver = IterativeSolverType.ConjugateGradient, int maxIterations = -1, double tolerance = -1,
+            VectorXD initialGuess = null, PreconditionerType preconditioner = PreconditionerType.Default, int fillFactor = -1, double dropTolerance = -1, double shift = -1,
+            bool recordHistory = false, int progressInterval = 1, Func<int, double, bool> progress = null)
         {
             Solver = solver;
             MaxIterations = maxIterations;
             Tolerance = tolerance;
+            InitialGuess = initialGuess;
+            Preconditioner = preconditioner;
+            FillFactor = fillFactor;
+            DropTolerance = dropTolerance;
+            Shift = shift;
+            RecordHistory = recordHistory;
+            ProgressInterval = progressInterval;
+            Progress = progress;
         }
     }
 }
@@ -0,0 +1,114 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Residual history and progress callback of one iterative solve, shared with the native
+    /// solver through pinned buffers (Data must match IterativeMonitor in EigenNative.cpp).
+    /// </summary>
+    internal sealed class IterativeSolverMonitor
+    {
+        [StructLayout(LayoutKind.Sequential)]
+        private struct Data
+        {
+            public int Interval;
+            public int HistoryCapacity;
+            public IntPtr HistoryIterations;
+            public IntPtr History;
+            public int HistoryCount;
+            public IntPtr Callback;
+            public int Stopped;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int ProgressCallback(int iteration, double residual);
+
+        private readonly Data[] _data = GC.AllocateArray<Data>(1, pinned: true);
+        private readonly int[] _historyIterations;
+        private readonly double[] _history;
+        private readonly Func<int, double, bool> _progress;
+        private readonly ProgressCallback _callback;
+        private Exception _exception;
+
+        /// <summary>
+        /// null when the solve neither records its history nor reports its progress.
+        /// </summary>
+        /// <param name="info"></param>
+        /// <param name="cols"></param>
+        /// <returns></returns>
+        public static IterativeSolverMonitor Create(IterativeSolverInfo info, int cols)
+        {
+            return info.RecordHistory || info.Progress != null ? new IterativeSolverMonitor(info, cols) : null;
+        }
+
+        public static IntPtr PointerOf(IterativeSolverMonitor monitor)
+        {
+            return monitor != null ? Marshal.UnsafeAddrOfPinnedArrayElement(monitor._data, 0) : IntPtr.Zero;
+        }
+
+        public bool Stopped => _data[0].Stopped != 0;
+
+        /// <summary>
+        /// Entries written by the last solve, rethrows an exception of the progress callback.
+        /// </summary>
+        /// <returns></returns>
+        public IReadOnlyList<(int Iteration, double Residual)> Complete()
+        {
+            if (_exception != null)
+            {
+                Exception exception = _exception;
+                _exception = null;
+                throw new InvalidOperationException("The iterative solver progress callback failed.", exception);
+            }
+
+            var history = new (int, double)[_history != null ? _data[0].HistoryCount : 0];
+            for (int i = 0; i < history.Length; i++)
+            {
+                history[i] = (_historyIterations[i], _history[i]);
+            }
+
+            return history;
+        }
+
+        private IterativeSolverMonitor(IterativeSolverInfo info, int cols)
+        {
+            // Eigen iterates at most 2 * cols times by default, one entry per interval and the final iterate.
+            int interval = Math.Max(info.ProgressInterval, 1);
+            int maxIterations = info.MaxIterations > 0 ? info.MaxIterations : 2 * cols;
+            _data[0].Interval = interval;
+
+            if (info.RecordHistory)
+            {
+                int capacity = maxIterations / interval + 1;
+                _historyIterations = GC.AllocateArray<int>(capacity, pinned: true);
+                _history = GC.AllocateArray<double>(capacity, pinned: true);
+                _data[0].HistoryCapacity = capacity;
+                _data[0].HistoryIterations = Marshal.UnsafeAddrOfPinnedArrayElement(_historyIterations, 0);
+                _data[0].History = Marshal.UnsafeAddrOfPinnedArrayElement(_history, 0);
+            }
+
+            if (info.Progress != null)
+            {
+                _progress = info.Progress;
+                _callback = OnProgress;
+                _data[0].Callback = Marshal.GetFunctionPointerForDelegate(_callback);
+            }
+        }
+
+        // exceptions must not unwind through the native solver, they stop it and are rethrown by Complete.
+        private int OnProgress(int iteration, double residual)
+        {
+            try
+            {
+                return _progress(iteration, residual) ? 0 : 1;
+            }
+            catch (Exception exception)
+            {
+                _exception = exception;
+                return 1;
+            }
+        }
+    }
+}
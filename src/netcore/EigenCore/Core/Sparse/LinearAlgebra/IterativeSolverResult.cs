@@ -1,16 +1,21 @@
 ﻿using EigenCore.Core.Dense;
+using System;
+using System.Collections.Generic;
 
 namespace EigenCore.Core.Sparse.LinearAlgebra
 {
     public class IterativeSolverResult
     {
-        public IterativeSolverResult(VectorXD result, int interations, double error, IterativeSolverType solver, bool success)
+        public IterativeSolverResult(VectorXD result, int interations, double error, IterativeSolverType solver, bool success,
+            IReadOnlyList<(int Iteration, double Residual)> residualHistory = null, bool stopped = false)
         {
             Result = result;
             Interations = interations;
             Error = error;
             Solver = solver;
             Success = success;
+            ResidualHistory = residualHistory ?? Array.Empty<(int, double)>();
+            Stopped = stopped;
         }
 
         public bool Success { get; }
@@ -18,5 +23,16 @@ namespace EigenCore.Core.Sparse.LinearAlgebra
         public int Interations { get; }
         public double Error { get; }
         public IterativeSolverType Solver { get; }
+
+        /// <summary>
+        /// Relative residuals recorded with <see cref="IterativeSolverInfo.RecordHistory"/>, the
+        /// last entry is the returned iterate. Empty when not recorded.
+        /// </summary>
+        public IReadOnlyList<(int Iteration, double Residual)> ResidualHistory { get; }
+
+        /// <summary>
+        /// true when <see cref="IterativeSolverInfo.Progress"/> stopped the solve.
+        /// </summary>
+        public bool Stopped { get; }
     }
 }
@@ -0,0 +1,22 @@
+﻿using EigenCore.Core.Dense;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    public class IterativeSolverResultF
+    {
+        public IterativeSolverResultF(VectorXF result, int interations, double error, IterativeSolverType solver, bool success)
+        {
+            Result = result;
+            Interations = interations;
+            Error = error;
+            Solver = solver;
+            Success = success;
+        }
+
+        public bool Success { get; }
+        public VectorXF Result { get; }
+        public int Interations { get; }
+        public double Error { get; }
+        public IterativeSolverType Solver { get; }
+    }
+}
@@ -0,0 +1,14 @@
+﻿namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    public enum PreconditionerType
+    {
+        /// <summary>
+        /// Eigen's choice for the solver: Identity for MINRES, Diagonal otherwise.
+        /// </summary>
+        Default,
+        Diagonal,
+        Identity,
+        IncompleteLUT,
+        IncompleteCholesky
+    }
+}
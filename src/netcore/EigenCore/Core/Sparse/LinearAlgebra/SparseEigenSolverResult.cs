@@ -0,0 +1,47 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.Complex;
+using EigenCore.Core.Shared;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    public class SparseEigenSolverResult
+    {
+        public SparseEigenSolverResult(VectorXCD eigenvalues, MatrixXCD eigenvectors, ComputationInfo info, bool symmetric, int restarts, int converged)
+        {
+            Eigenvalues = eigenvalues;
+            Eigenvectors = eigenvectors;
+            Info = info;
+            Symmetric = symmetric;
+            Restarts = restarts;
+            Converged = converged;
+        }
+
+        /// <summary>
+        /// In order of selection, real for a symmetric matrix.
+        /// </summary>
+        public VectorXCD Eigenvalues { get; }
+
+        /// <summary>
+        /// Unit eigenvectors by column, their largest entry real and positive.
+        /// </summary>
+        public MatrixXCD Eigenvectors { get; }
+
+        /// <summary>
+        /// NoConvergence when fewer than the requested eigenpairs met the tolerance, the best
+        /// approximations are returned; NumericalIssue when A - sigma I is singular.
+        /// </summary>
+        public ComputationInfo Info { get; }
+        public bool Success => Info == ComputationInfo.Success;
+
+        /// <summary>
+        /// true when the Lanczos (symmetric) variant ran, the matrix equals its transpose.
+        /// </summary>
+        public bool Symmetric { get; }
+        public int Restarts { get; }
+
+        /// <summary>
+        /// Number of the requested eigenpairs that met the tolerance.
+        /// </summary>
+        public int Converged { get; }
+    }
+}
@@ -0,0 +1,106 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Native sparse direct solver kept alive between solves.
+    /// The ordering and symbolic analysis are computed once per sparsity pattern,
+    /// so refactorizing a matrix with new values only repeats the numeric factorization.
+    /// </summary>
+    public class SparseFactorization : NativeHandle
+    {
+        private SparseMatrixD _pattern;
+
+        public DirectSolverType Solver { get; }
+
+        public int Rows => _pattern.Rows;
+
+        public int Cols => _pattern.Cols;
+
+        public bool Success { get; private set; }
+
+        /// <summary>
+        /// Ordering and symbolic time of the last analysis, numeric time and fill-in of the last
+        /// factorization and time of the last solve.
+        /// </summary>
+        public DirectSolverStats Stats
+        {
+            get
+            {
+                ThrowIfDisposed();
+                return EigenSparseUtilities.FactorizationStats(Handle);
+            }
+        }
+
+        private bool SamePattern(SparseMatrixD matrix)
+        {
+            return matrix.Rows == _pattern.Rows && matrix.Cols == _pattern.Cols && matrix.Nnz == _pattern.Nnz &&
+                matrix.GetOuterStarts().SequenceEqual(_pattern.GetOuterStarts()) &&
+                matrix.GetInnerIndices().SequenceEqual(_pattern.GetInnerIndices());
+        }
+
+        private void AnalyzePattern(SparseMatrixD matrix)
+        {
+            EigenSparseUtilities.FactorizationAnalyzePattern(Handle, matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues());
+            _pattern = matrix;
+        }
+
+        /// <summary>
+        /// Numeric factorization of a matrix. The symbolic analysis is only
+        /// repeated when the sparsity pattern differs from the previous matrix.
+        /// </summary>
+        /// <param name="matrix"></param>
+        /// <returns>true if the factorization succeeded.</returns>
+        public bool Factorize(SparseMatrixD matrix)
+        {
+            ThrowIfDisposed();
+
+            if (!SamePattern(matrix))
+            {
+                AnalyzePattern(matrix);
+            }
+
+            Success = EigenSparseUtilities.FactorizationFactorize(Handle, matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues());
+            return Success;
+        }
+
+        public VectorXD Solve(VectorXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Cols];
+            EigenSparseUtilities.FactorizationSolve(Handle, rhs.GetValues(), x);
+            return new VectorXD(x);
+        }
+
+        /// <summary>
+        /// A X = B for every column of B.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <returns></returns>
+        public MatrixXD Solve(MatrixXD rhs)
+        {
+            ThrowIfDisposed();
+            double[] x = new double[Cols * rhs.Cols];
+            EigenSparseUtilities.FactorizationSolveBlock(Handle, rhs.GetValues(), rhs.Rows, rhs.Cols, x, Cols);
+            return new MatrixXD(x, Cols, rhs.Cols);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenSparseUtilities.FactorizationDestroy(handle);
+        }
+
+        internal SparseFactorization(SparseMatrixD matrix, DirectSolverType solver)
+            : base(EigenSparseUtilities.FactorizationCreate((int)solver))
+        {
+            Solver = solver;
+            AnalyzePattern(matrix);
+            Factorize(matrix);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Native iterative solver kept alive between solves.
+    /// The preconditioner (e.g. an incomplete factorization) is built once per matrix
+    /// and reused by every solve until the next Compute.
+    /// </summary>
+    public class SparseIterativeSolver : NativeHandle
+    {
+        public IterativeSolverInfo Info { get; }
+
+        public int Rows { get; private set; }
+
+        public int Cols { get; private set; }
+
+        /// <summary>
+        /// false if the preconditioner could not be built.
+        /// </summary>
+        public bool Success { get; private set; }
+
+        /// <summary>
+        /// Copies the matrix and rebuilds the preconditioner.
+        /// </summary>
+        /// <param name="matrix"></param>
+        /// <returns>true if the preconditioner was built.</returns>
+        public bool Compute(SparseMatrixD matrix)
+        {
+            ThrowIfDisposed();
+            Rows = matrix.Rows;
+            Cols = matrix.Cols;
+            Success = EigenSparseUtilities.IterativeSolverCompute(Handle, matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues(), Info.FillFactor, Info.DropTolerance, Info.Shift);
+            return Success;
+        }
+
+        /// <summary>
+        /// A x = b, starting from initialGuess when given, otherwise from Info.InitialGuess.
+        /// </summary>
+        /// <param name="rhs"></param>
+        /// <param name="initialGuess"></param>
+        /// <returns></returns>
+        public IterativeSolverResult Solve(VectorXD rhs, VectorXD initialGuess = null)
+        {
+            ThrowIfDisposed();
+            initialGuess ??= Info.InitialGuess;
+            double[] x = new double[rhs.Length];
+            var monitor = IterativeSolverMonitor.Create(Info, Cols);
+            bool success = EigenSparseUtilities.IterativeSolverSolve(Handle, Info.MaxIterations, Info.Tolerance,
+                rhs.GetValues(), rhs.Length, initialGuess != null ? initialGuess.GetValues() : ReadOnlySpan<double>.Empty,
+                x, out int iterations, out double error, IterativeSolverMonitor.PointerOf(monitor));
+            return new IterativeSolverResult(new VectorXD(x), iterations, error, Info.Solver, success,
+                monitor?.Complete(), monitor?.Stopped ?? false);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenSparseUtilities.IterativeSolverDestroy(handle);
+        }
+
+        internal SparseIterativeSolver(SparseMatrixD matrix, IterativeSolverInfo info)
+            : base(EigenSparseUtilities.IterativeSolverCreate((int)info.Solver, (int)info.Preconditioner))
+        {
+            Info = info;
+            Compute(matrix);
+        }
+    }
+}
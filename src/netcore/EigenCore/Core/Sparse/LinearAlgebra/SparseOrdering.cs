@@ -0,0 +1,20 @@
+﻿namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    /// <summary>
+    /// Fill-reducing ordering a sparse direct solver applied before factorizing.
+    /// </summary>
+    public enum SparseOrdering
+    {
+        Natural,
+
+        /// <summary>
+        /// Approximate minimum degree on the symmetric pattern, used by SimplicialLLT and SimplicialLDLT.
+        /// </summary>
+        AMD,
+
+        /// <summary>
+        /// Column approximate minimum degree, used by SparseLU and SparseQR.
+        /// </summary>
+        COLAMD
+    }
+}
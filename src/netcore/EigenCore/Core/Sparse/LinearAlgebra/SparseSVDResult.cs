@@ -0,0 +1,46 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+
+namespace EigenCore.Core.Sparse.LinearAlgebra
+{
+    public class SparseSVDResult
+    {
+        public SparseSVDResult(MatrixXD u, VectorXD s, MatrixXD v, ComputationInfo info, int restarts, int converged)
+        {
+            U = u;
+            S = s;
+            V = v;
+            Info = info;
+            Restarts = restarts;
+            Converged = converged;
+        }
+
+        /// <summary>
+        /// Left singular vectors by column, Rows x k.
+        /// </summary>
+        public MatrixXD U { get; }
+
+        /// <summary>
+        /// The k largest singular values in decreasing order.
+        /// </summary>
+        public VectorXD S { get; }
+
+        /// <summary>
+        /// Right singular vectors by column, Cols x k, their largest entry positive.
+        /// </summary>
+        public MatrixXD V { get; }
+
+        /// <summary>
+        /// NoConvergence when fewer than the requested triplets met the tolerance, the best
+        /// approximations are returned.
+        /// </summary>
+        public ComputationInfo Info { get; }
+        public bool Success => Info == ComputationInfo.Success;
+        public int Restarts { get; }
+
+        /// <summary>
+        /// Number of the requested triplets that met the tolerance.
+        /// </summary>
+        public int Converged { get; }
+    }
+}
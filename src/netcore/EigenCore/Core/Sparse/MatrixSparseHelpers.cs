@@ -1,4 +1,5 @@
 ﻿using EigenCore.Core.Dense;
+using EigenCore.Eigen;
 using System;
 using System.Collections.Generic;
 using System.Linq;
@@ -10,37 +11,67 @@ namespace EigenCore.Core.Sparse
         const double ZeroTolerance = 10e-12;
 
         /// <summary>
-        /// 
+        /// Compressed column storage of the (row, col, value) triplets, assembled natively with
+        /// duplicates summed.
         /// </summary>
         /// <param name="positionAndValues"></param>
+        /// <param name="rows"></param>
         /// <param name="cols"></param>
         /// <returns></returns>
-        public static (double[], int[], int[]) ToCCS(List<(int, int, double)> positionAndValues, int cols)
+        public static (double[], int[], int[]) ToCCS(IList<(int, int, double)> positionAndValues, int rows, int cols)
         {
-            List<double> values = new List<double>();
-            List<int> innerIndices = new List<int>();
+            var (rowIndices, colIndices, values) = SplitTriplets(positionAndValues, rows, cols);
             int[] outerStarts = new int[cols + 1];
+            int[] innerIndices = new int[values.Length];
+            double[] outValues = new double[values.Length];
+            int nnz = EigenSparseUtilities.FromTriplets(rows, cols, values.Length, rowIndices, colIndices, values,
+                outerStarts, innerIndices, outValues);
+            Array.Resize(ref innerIndices, nnz);
+            Array.Resize(ref outValues, nnz);
+            return (outValues, innerIndices, outerStarts);
+        }
 
-            positionAndValues.Sort((x, y) => {
-                var result = x.Item1.CompareTo(y.Item1);
-                return result == 0 ? x.Item2.CompareTo(y.Item2) : result;
-            });
+        /// <summary>
+        /// Single precision counterpart of <see cref="ToCCS(IList{ValueTuple{int, int, double}}, int, int)"/>.
+        /// </summary>
+        /// <param name="positionAndValues"></param>
+        /// <param name="rows"></param>
+        /// <param name="cols"></param>
+        /// <returns></returns>
+        public static (float[], int[], int[]) ToCCS(IList<(int, int, float)> positionAndValues, int rows, int cols)
+        {
+            var (rowIndices, colIndices, values) = SplitTriplets(positionAndValues, rows, cols);
+            int[] outerStarts = new int[cols + 1];
+            int[] innerIndices = new int[values.Length];
+            float[] outValues = new float[values.Length];
+            int nnz = EigenSparseUtilities.FromTriplets(rows, cols, values.Length, rowIndices, colIndices, values,
+                outerStarts, innerIndices, outValues);
+            Array.Resize(ref innerIndices, nnz);
+            Array.Resize(ref outValues, nnz);
+            return (outValues, innerIndices, outerStarts);
+        }
 
-            for (int col = 0; col < cols; col++)
+        private static (int[], int[], T[]) SplitTriplets<T>(IList<(int, int, T)> positionAndValues, int rows, int cols)
+        {
+            int count = positionAndValues.Count;
+            int[] rowIndices = new int[count];
+            int[] colIndices = new int[count];
+            T[] values = new T[count];
+
+            for (int i = 0; i < count; i++)
             {
-                var colElements = positionAndValues.Where(pV => pV.Item2 == col);
-                int count = 0;
-                foreach (var element in colElements)
+                var (row, col, value) = positionAndValues[i];
+                if ((uint)row >= (uint)rows || (uint)col >= (uint)cols)
                 {
-                    values.Add(element.Item3);
-                    innerIndices.Add(element.Item1);
-                    count++;
+                    throw new ArgumentOutOfRangeException(nameof(positionAndValues), $"({row}, {col}) is outside a {rows} x {cols} matrix.");
                 }
 
-                outerStarts[col + 1] = count + outerStarts[col];
+                rowIndices[i] = row;
+                colIndices[i] = col;
+                values[i] = value;
             }
 
-            return (values.ToArray(), innerIndices.ToArray(), outerStarts.ToArray());
+            return (rowIndices, colIndices, values);
         }
 
         /// <summary>
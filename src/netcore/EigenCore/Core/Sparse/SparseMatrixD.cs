@@ -1,4 +1,6 @@
 ﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.Complex;
+using EigenCore.Core.Dense.LinearAlgebra;
 using EigenCore.Core.Shared;
 using EigenCore.Core.Sparse.LinearAlgebra;
 using EigenCore.Eigen;
@@ -12,25 +14,6 @@ namespace EigenCore.Core.Sparse
     {
         private static readonly IterativeSolverInfo _defaultIterativeSolverInfo = new IterativeSolverInfo();
 
-        private int NonZeroUpperBound(SparseMatrixD other)
-        {
-            var outerStarts = _outerStarts;
-            var outStartsOther = other._outerStarts;
-            var elementsPerColum = new int[Cols];
-            var elementsPerColumOther = new int[other.Cols];
-            for (int i = 0; i <= outerStarts.Length - 2; i++)
-            {
-                elementsPerColum[i] = outerStarts[i + 1] - outerStarts[i];
-            }
-
-            for (int i = 0; i <= outStartsOther.Length - 2; i++)
-            {
-                elementsPerColumOther[i] = outStartsOther[i + 1] - outStartsOther[i];
-            }
-
-            return Math.Min(elementsPerColum.Max() * elementsPerColumOther.Max() * Cols, Cols * Rows);
-        }
-
         private bool IsEqual(SparseMatrixD other)
         {
             if (Rows != other.Rows || Cols != other.Cols)
@@ -324,31 +307,29 @@ namespace EigenCore.Core.Sparse
 
         public SparseMatrixD Add(SparseMatrixD other)
         {
-            int[] innerIndices = new int[Nnz + other.Nnz];
             int[] outOuterStarts = new int[Cols + 1];
-            double[] values = new double[Nnz + other.Nnz];
-            int nnz;
+            int nnz = Eigen.EigenSparseUtilities.AddSymbolic(Rows, Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
+            int[] innerIndices = new int[nnz];
+            double[] values = new double[nnz];
             Eigen.EigenSparseUtilities.ADD(Rows, Cols,
                Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
                other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
-               outOuterStarts, innerIndices, values, out nnz);
-            Array.Resize(ref innerIndices, nnz);
-            Array.Resize(ref values, nnz);
+               outOuterStarts, innerIndices, values);
             return new SparseMatrixD(values, innerIndices, outOuterStarts, Rows, Cols);
         }
 
         public SparseMatrixD Minus(SparseMatrixD other)
         {
-            int[] innerIndices = new int[Nnz + other.Nnz];
             int[] outOuterStarts = new int[Cols + 1];
-            double[] values = new double[Nnz + other.Nnz];
-            int nnz;
+            int nnz = Eigen.EigenSparseUtilities.AddSymbolic(Rows, Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
+            int[] innerIndices = new int[nnz];
+            double[] values = new double[nnz];
             Eigen.EigenSparseUtilities.Minus(Rows, Cols,
                Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
                other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
-               outOuterStarts, innerIndices, values, out nnz);
-            Array.Resize(ref innerIndices, nnz);
-            Array.Resize(ref values, nnz);
+               outOuterStarts, innerIndices, values);
             return new SparseMatrixD(values, innerIndices, outOuterStarts, Rows, Cols);
         }
 
@@ -360,20 +341,60 @@ namespace EigenCore.Core.Sparse
             return new VectorXD(values);
         }
 
+        /// <summary>
+        /// Copies the matrix once to row-major storage for repeated, multithreaded products with vectors.
+        /// </summary>
+        /// <returns></returns>
+        public SparseMatrixVectorProduct CreateMultiplier()
+        {
+            return new SparseMatrixVectorProduct(this);
+        }
+
         public SparseMatrixD Mult(SparseMatrixD other)
         {
-            var upperBound = NonZeroUpperBound(other);
+            if (Cols != other.Rows)
+            {
+                throw new ArgumentException($"Expected a matrix with {Cols} rows.", nameof(other));
+            }
+
+            int[] outOuterStarts = new int[other.Cols + 1];
+            int nnz = Eigen.EigenSparseUtilities.MultSymbolic(Rows, Cols, other.Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
+            int[] innerIndices = new int[nnz];
+            double[] values = new double[nnz];
+            Eigen.EigenSparseUtilities.Mult(Rows, Cols, other.Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
+               other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
+               outOuterStarts, innerIndices, values);
+            return new SparseMatrixD(values, innerIndices, outOuterStarts, Rows, other.Cols);
+        }
+
+        /// <summary>
+        /// Sparse product that drops entries with magnitude &lt;= dropTolerance, e.g. to keep
+        /// Galerkin coarse operators or graph powers sparse.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="dropTolerance"></param>
+        /// <returns></returns>
+        public SparseMatrixD Mult(SparseMatrixD other, double dropTolerance)
+        {
+            if (Cols != other.Rows)
+            {
+                throw new ArgumentException($"Expected a matrix with {Cols} rows.", nameof(other));
+            }
+
+            int[] outOuterStarts = new int[other.Cols + 1];
+            int upperBound = Eigen.EigenSparseUtilities.MultSymbolic(Rows, Cols, other.Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
             int[] innerIndices = new int[upperBound];
-            int[] outOuterStarts = new int[Cols + 1];
             double[] values = new double[upperBound];
-            int nnz;
-            Eigen.EigenSparseUtilities.Mult(Rows, Cols,
+            int nnz = Eigen.EigenSparseUtilities.MultPruned(Rows, Cols, other.Cols,
                Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
                other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
-               outOuterStarts, innerIndices, values, out nnz);
+               dropTolerance, outOuterStarts, innerIndices, values);
             Array.Resize(ref innerIndices, nnz);
             Array.Resize(ref values, nnz);
-            return new SparseMatrixD(values, innerIndices, outOuterStarts, Rows, Cols);
+            return new SparseMatrixD(values, innerIndices, outOuterStarts, Rows, other.Cols);
         }
 
         public SparseMatrixD Transpose()
@@ -389,6 +410,132 @@ namespace EigenCore.Core.Sparse
         }
 
         public IterativeSolverResult IterativeSolve(VectorXD other, IterativeSolverInfo iterativeSolverInfo = default(IterativeSolverInfo))
+        {
+            return IterativeSolve(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, iterativeSolverInfo);
+        }
+
+        /// <summary>
+        /// Builds the preconditioner once, the returned solver can be used for many
+        /// right-hand sides of the same matrix.
+        /// </summary>
+        /// <param name="iterativeSolverInfo"></param>
+        /// <returns></returns>
+        public SparseIterativeSolver CreateIterativeSolver(IterativeSolverInfo iterativeSolverInfo = default(IterativeSolverInfo))
+        {
+            return new SparseIterativeSolver(this, iterativeSolverInfo ?? _defaultIterativeSolverInfo);
+        }
+
+        public VectorXD DirectSolve(VectorXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            return DirectSolve(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, directSolverType);
+        }
+
+        /// <summary>
+        /// Same as <see cref="DirectSolve(VectorXD, DirectSolverType)"/>, also returns whether the factorization
+        /// succeeded, the time spent in each phase and the fill-in. Mixed precision types are not supported.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="directSolverType"></param>
+        /// <returns></returns>
+        public DirectSolverResult DirectSolveWithStats(VectorXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            return DirectSolveWithStats(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, directSolverType);
+        }
+
+        /// <summary>
+        /// Factorizes in single precision and refines the solution in double until it reaches double accuracy,
+        /// falls back to the double factorization when refinement stalls. SimplicialLDLT and
+        /// MixedPrecisionSimplicialLDLT use SimplicialLDLT, any other type SparseLU.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="directSolverType"></param>
+        /// <returns></returns>
+        public MixedPrecisionResult DirectSolveMixedPrecision(VectorXD other, DirectSolverType directSolverType = DirectSolverType.MixedPrecisionSparseLU)
+        {
+            return DirectSolveMixedPrecision(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other, directSolverType);
+        }
+
+        /// <summary>
+        /// k eigenpairs of a square matrix without densifying it: thick-restart Lanczos when the matrix
+        /// is symmetric, Krylov-Schur otherwise. <see cref="EigenvalueSelection.NearestSigma"/> factorizes
+        /// A - sigma I once (shift-invert) and converges fastest for small or interior eigenvalues.
+        /// </summary>
+        /// <param name="k"></param>
+        /// <param name="which"></param>
+        /// <param name="sigma">shift of <see cref="EigenvalueSelection.NearestSigma"/>.</param>
+        /// <param name="subspaceSize">Krylov vectors kept, max(2k + 1, 20) when &lt;= 0.</param>
+        /// <param name="maxRestarts">1000 when &lt;= 0.</param>
+        /// <param name="tolerance">Ritz residual relative to the eigenvalue, 1e-10 when &lt;= 0.</param>
+        /// <returns></returns>
+        public SparseEigenSolverResult Eigs(int k, EigenvalueSelection which = EigenvalueSelection.Largest, double sigma = 0,
+            int subspaceSize = -1, int maxRestarts = -1, double tolerance = -1)
+        {
+            return Eigs(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), k, which, sigma, subspaceSize, maxRestarts, tolerance);
+        }
+
+        /// <summary>
+        /// The k largest singular triplets by thick-restart Golub-Kahan-Lanczos bidiagonalization.
+        /// The matrix is only used through A * x and A^T * y on its CSC arrays, neither A^T nor
+        /// A^T A is formed; raise subspaceSize when the wanted singular values are clustered.
+        /// </summary>
+        /// <param name="k"></param>
+        /// <param name="subspaceSize">Lanczos vectors kept, max(2k + 1, 20) when &lt;= 0.</param>
+        /// <param name="maxRestarts">1000 when &lt;= 0.</param>
+        /// <param name="tolerance">residual relative to the largest singular value, 1e-10 when &lt;= 0.</param>
+        /// <returns></returns>
+        public SparseSVDResult Svds(int k, int subspaceSize = -1, int maxRestarts = -1, double tolerance = -1)
+        {
+            return Svds(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), k, subspaceSize, maxRestarts, tolerance);
+        }
+
+        /// <summary>
+        /// A X = B for every column of B, the matrix is factorized once in a single native call.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="directSolverType"></param>
+        /// <returns></returns>
+        public MatrixXD DirectSolve(MatrixXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            double[] x = new double[Cols * other.Cols];
+            EigenSparseUtilities.SolveBlock((int)directSolverType, Rows, Cols, Nnz, GetOuterStarts(),
+                GetInnerIndices(), GetValues(), other.GetValues(), other.Cols, x);
+            return new MatrixXD(x, Cols, other.Cols);
+        }
+
+        /// <summary>
+        /// Factorizes the matrix once, the returned factorization can be used for many solves
+        /// and refactorized with new values on the same sparsity pattern. Mixed precision types
+        /// are factorized in double.
+        /// </summary>
+        /// <param name="directSolverType"></param>
+        /// <returns></returns>
+        public SparseFactorization Factorize(DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            return new SparseFactorization(this, directSolverType);
+        }
+
+        public VectorXD LeastSquares(VectorXD other)
+        {
+            double[] x = new double[Cols];
+            EigenSparseUtilities.LeastSquaresLU(Rows, Cols, Nnz, GetOuterStarts(),
+                GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+
+            return new VectorXD(x);
+        }
+
+        public double AbsoluteError(VectorXD rhs, VectorXD x)
+        {
+            return EigenSparseUtilities.AbsoluteError(Rows, Cols, Nnz, GetOuterStarts(),
+                      GetInnerIndices(), GetValues(), rhs.GetValues(), x.GetValues());
+        }
+
+        public double RelativeError(VectorXD rhs, VectorXD x)
+        {
+            return EigenSparseUtilities.RelativeError(Rows, Cols, Nnz, GetOuterStarts(),
+                      GetInnerIndices(), GetValues(), rhs.GetValues(), x.GetValues());
+        }
+
+        internal static IterativeSolverResult IterativeSolve(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values, VectorXD other, IterativeSolverInfo iterativeSolverInfo)
         {
             double[] x = new double[other.Length];
             bool success;
@@ -400,160 +547,248 @@ namespace EigenCore.Core.Sparse
                 iterativeSolverInfo = _defaultIterativeSolverInfo;
             }
 
+            ReadOnlySpan<double> initialGuess = iterativeSolverInfo.HasInitialGuess ?
+                iterativeSolverInfo.InitialGuess.GetValues() : ReadOnlySpan<double>.Empty;
+            var monitor = IterativeSolverMonitor.Create(iterativeSolverInfo, cols);
+            IntPtr pMonitor = IterativeSolverMonitor.PointerOf(monitor);
+
             switch (iterativeSolverInfo.Solver)
             {
                 case IterativeSolverType.BiCGSTAB:
                     success = EigenSparseUtilities.SolveBiCGSTAB(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
                 case IterativeSolverType.GMRES:
                     success = EigenSparseUtilities.SolveGMRES(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
                 case IterativeSolverType.MINRES:
                     success = EigenSparseUtilities.SolveMINRES(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
                 case IterativeSolverType.DGMRES:
                     success = EigenSparseUtilities.SolveDGMRES(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
                 case IterativeSolverType.LeastSquaresConjugateGradient:
                     success = EigenSparseUtilities.SolveLeastSquaresConjugateGradient(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
                 case IterativeSolverType.ConjugateGradient:
                 default:
                     success = EigenSparseUtilities.SolveConjugateGradient(
-                       Rows,
-                       Cols,
-                       Nnz,
+                       rows,
+                       cols,
+                       nnz,
                        iterativeSolverInfo.MaxIterations,
                        iterativeSolverInfo.Tolerance,
-                       GetOuterStarts(),
-                       GetInnerIndices(),
-                       GetValues(),
+                       (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor,
+                       iterativeSolverInfo.DropTolerance,
+                       iterativeSolverInfo.Shift,
+                       outerStarts,
+                       innerIndices,
+                       values,
                        other.GetValues(),
                        other.Length,
+                       initialGuess,
                        x,
                        out iterations,
-                       out error);
+                       out error,
+                       pMonitor);
                     break;
             }
 
-            return new IterativeSolverResult(new VectorXD(x), iterations, error, iterativeSolverInfo.Solver, success);
+            return new IterativeSolverResult(new VectorXD(x), iterations, error, iterativeSolverInfo.Solver, success,
+                monitor?.Complete(), monitor?.Stopped ?? false);
         }
 
-        public VectorXD DirectSolve(VectorXD other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        internal static VectorXD DirectSolve(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values, VectorXD other, DirectSolverType directSolverType)
+        {
+            switch (directSolverType)
+            {
+                case DirectSolverType.MixedPrecisionSparseLU:
+                case DirectSolverType.MixedPrecisionSimplicialLDLT:
+                    return DirectSolveMixedPrecision(rows, cols, nnz, outerStarts, innerIndices, values, other, directSolverType).Result;
+                default:
+                    return DirectSolveWithStats(rows, cols, nnz, outerStarts, innerIndices, values, other, directSolverType).Result;
+            }
+        }
+
+        internal static SparseEigenSolverResult Eigs(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values,
+            int k, EigenvalueSelection which, double sigma, int subspaceSize, int maxRestarts, double tolerance)
+        {
+            if (rows != cols)
+            {
+                throw new ArgumentException("Expected a square matrix.");
+            }
+
+            if (k < 1 || k > rows)
+            {
+                throw new ArgumentOutOfRangeException(nameof(k), $"Expected between 1 and {rows} eigenpairs.");
+            }
+
+            double[] realValues = new double[k];
+            double[] imagValues = new double[k];
+            double[] realVectors = new double[rows * k];
+            double[] imagVectors = new double[rows * k];
+            int info = EigenSparseUtilities.Eigs(rows, cols, nnz, outerStarts, innerIndices, values, k, (int)which, sigma, subspaceSize, maxRestarts, tolerance,
+                realValues, imagValues, realVectors, imagVectors, out bool symmetric, out int restarts, out int converged);
+
+            return new SparseEigenSolverResult(new VectorXCD(realValues, imagValues), new MatrixXCD(realVectors, imagVectors, rows, k),
+                (ComputationInfo)info, symmetric, restarts, converged);
+        }
+
+        internal static SparseSVDResult Svds(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values,
+            int k, int subspaceSize, int maxRestarts, double tolerance)
+        {
+            int minRowsCols = Math.Min(rows, cols);
+            if (k < 1 || k > minRowsCols)
+            {
+                throw new ArgumentOutOfRangeException(nameof(k), $"Expected between 1 and {minRowsCols} singular triplets.");
+            }
+
+            double[] uout = new double[rows * k];
+            double[] sout = new double[k];
+            double[] vout = new double[cols * k];
+            int info = EigenSparseUtilities.Svds(rows, cols, nnz, outerStarts, innerIndices, values, k, subspaceSize, maxRestarts, tolerance,
+                uout, sout, vout, out int restarts, out int converged);
+
+            return new SparseSVDResult(new MatrixXD(uout, rows, k), new VectorXD(sout), new MatrixXD(vout, cols, k),
+                (ComputationInfo)info, restarts, converged);
+        }
+
+        internal static DirectSolverResult DirectSolveWithStats(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values, VectorXD other, DirectSolverType directSolverType)
         {
             double[] x = new double[other.Length];
+            DirectSolverStats stats;
             switch (directSolverType)
             {
                 case DirectSolverType.SimplicialLLT:
-                    EigenSparseUtilities.SolveSimplicialLLT(Rows, Cols, Nnz, GetOuterStarts(),
-                        GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    EigenSparseUtilities.SolveSimplicialLLT(rows, cols, nnz, outerStarts,
+                        innerIndices, values, other.GetValues(), other.Length, x, out stats);
                     break;
                 case DirectSolverType.SimplicialLDLT:
-                    EigenSparseUtilities.SolveSimplicialLDLT(Rows, Cols, Nnz, GetOuterStarts(),
-                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    EigenSparseUtilities.SolveSimplicialLDLT(rows, cols, nnz, outerStarts,
+                      innerIndices, values, other.GetValues(), other.Length, x, out stats);
                     break;
                 case DirectSolverType.SparseQR:
-                    EigenSparseUtilities.SolveSparseQR(Rows, Cols, Nnz, GetOuterStarts(),
-                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    EigenSparseUtilities.SolveSparseQR(rows, cols, nnz, outerStarts,
+                      innerIndices, values, other.GetValues(), other.Length, x, out stats);
                     break;
+                case DirectSolverType.MixedPrecisionSparseLU:
+                case DirectSolverType.MixedPrecisionSimplicialLDLT:
+                    throw new ArgumentException("Mixed precision solvers do not report stats, use DirectSolveMixedPrecision.", nameof(directSolverType));
                 case DirectSolverType.SparseLU:
                 default:
-                    EigenSparseUtilities.SolveSparseLU(Rows, Cols, Nnz, GetOuterStarts(),
-                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    EigenSparseUtilities.SolveSparseLU(rows, cols, nnz, outerStarts,
+                      innerIndices, values, other.GetValues(), other.Length, x, out stats);
                     break;
             }
 
-            return new VectorXD(x);
+            return new DirectSolverResult(new VectorXD(x), stats, directSolverType);
         }
 
-        public VectorXD LeastSquares(VectorXD other)
+        internal static MixedPrecisionResult DirectSolveMixedPrecision(int rows, int cols, int nnz, ReadOnlySpan<int> outerStarts, ReadOnlySpan<int> innerIndices, ReadOnlySpan<double> values, VectorXD other, DirectSolverType directSolverType)
         {
-            double[] x = new double[Cols];
-            EigenSparseUtilities.LeastSquaresLU(Rows, Cols, Nnz, GetOuterStarts(),
-                GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
-
-            return new VectorXD(x);
-        }
-
-        public double AbsoluteError(VectorXD rhs, VectorXD x)
-        {
-            return EigenSparseUtilities.AbsoluteError(Rows, Cols, Nnz, GetOuterStarts(),
-                      GetInnerIndices(), GetValues(), rhs.GetValues(), x.GetValues());
-        }
-
-        public double RelativeError(VectorXD rhs, VectorXD x)
-        {
-            return EigenSparseUtilities.RelativeError(Rows, Cols, Nnz, GetOuterStarts(),
-                      GetInnerIndices(), GetValues(), rhs.GetValues(), x.GetValues());
+            double[] x = new double[cols];
+            bool converged = EigenSparseUtilities.SolveMixedPrecision((int)directSolverType, rows, cols, nnz, outerStarts,
+                innerIndices, values, other.GetValues(), other.Length, x, out int steps);
+            return new MixedPrecisionResult(new VectorXD(x), steps, converged);
         }
 
         public SparseMatrixD(IList<(int, int, double)> sparseInfo, int rows, int cols)
-            : base(MatrixSparseHelpers.ToCCS(sparseInfo.ToList(), cols), rows, cols)
+            : base(MatrixSparseHelpers.ToCCS(sparseInfo, rows, cols), rows, cols)
         {
         }
 
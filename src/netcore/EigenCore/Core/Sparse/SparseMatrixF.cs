@@ -0,0 +1,240 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using EigenCore.Core.Sparse.LinearAlgebra;
+using EigenCore.Eigen;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace EigenCore.Core.Sparse
+{
+    /// <summary>
+    /// Single precision sparse matrix in compressed column storage, half the memory
+    /// and bandwidth of <see cref="SparseMatrixD"/> for the same pattern.
+    /// </summary>
+    public class SparseMatrixF : MatrixSparseBase<float>
+    {
+        private static readonly IterativeSolverInfo _defaultIterativeSolverInfo = new IterativeSolverInfo();
+
+        private bool IsEqual(SparseMatrixF other)
+        {
+            if (Rows != other.Rows || Cols != other.Cols)
+            {
+                return false;
+            }
+
+            return ArrayHelpers.ArraysEqual(_values, other._values) &&
+                ArrayHelpers.ArraysEqual(_innerIndices, other._innerIndices) &&
+                ArrayHelpers.ArraysEqual(_outerStarts, other._outerStarts);
+        }
+
+        public static SparseMatrixF Identity(int size)
+        {
+            (int, int, float)[] positions = new (int, int, float)[size];
+
+            for (int i = 0; i < size; i++)
+            {
+                positions[i] = (i, i, 1.0f);
+            }
+
+            return new SparseMatrixF(positions, size, size);
+        }
+
+        public float Max() => _values.AsParallel().Max();
+
+        public float Min() => _values.AsParallel().Min();
+
+        public float Sum() => _values.AsParallel().Sum();
+
+        public float Norm() => EigenSparseUtilities.Norm(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues());
+
+        public float SquaredNorm() => EigenSparseUtilities.SquaredNorm(Rows, Cols, Nnz, GetOuterStarts(), GetInnerIndices(), GetValues());
+
+        public SparseMatrixF Add(SparseMatrixF other)
+        {
+            int[] outOuterStarts = new int[Cols + 1];
+            int nnz = EigenSparseUtilities.AddSymbolic(Rows, Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
+            int[] innerIndices = new int[nnz];
+            float[] values = new float[nnz];
+            EigenSparseUtilities.ADD(Rows, Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
+               other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
+               outOuterStarts, innerIndices, values);
+            return new SparseMatrixF(values, innerIndices, outOuterStarts, Rows, Cols);
+        }
+
+        public SparseMatrixF Minus(SparseMatrixF other)
+        {
+            int[] outOuterStarts = new int[Cols + 1];
+            int nnz = EigenSparseUtilities.AddSymbolic(Rows, Cols,
+               GetOuterStarts(), GetInnerIndices(), other.GetOuterStarts(), other.GetInnerIndices(), outOuterStarts);
+            int[] innerIndices = new int[nnz];
+            float[] values = new float[nnz];
+            EigenSparseUtilities.Minus(Rows, Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
+               other.Nnz, other.GetOuterStarts(), other.GetInnerIndices(), other.GetValues(),
+               outOuterStarts, innerIndices, values);
+            return new SparseMatrixF(values, innerIndices, outOuterStarts, Rows, Cols);
+        }
+
+        public VectorXF Mult(VectorXF other)
+        {
+            float[] values = new float[Rows];
+            EigenSparseUtilities.Mult(Rows, Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, values);
+            return new VectorXF(values);
+        }
+
+        public SparseMatrixF Transpose()
+        {
+            int[] innerIndices = new int[Nnz];
+            int[] outOuterStarts = new int[Rows + 1];
+            float[] values = new float[Nnz];
+            EigenSparseUtilities.Transpose(Rows, Cols,
+               Nnz, GetOuterStarts(), GetInnerIndices(), GetValues(),
+               outOuterStarts, innerIndices, values);
+
+            return new SparseMatrixF(values, innerIndices, outOuterStarts, Cols, Rows);
+        }
+
+        /// <summary>
+        /// Single precision counterpart of <see cref="SparseMatrixD.IterativeSolve"/>, tolerance and
+        /// the reported error stay in double. DGMRES is served by MINRES.
+        /// </summary>
+        /// <param name="other"></param>
+        /// <param name="iterativeSolverInfo"></param>
+        /// <returns></returns>
+        public IterativeSolverResultF IterativeSolve(VectorXF other, IterativeSolverInfo iterativeSolverInfo = default(IterativeSolverInfo))
+        {
+            float[] x = new float[other.Length];
+            bool success;
+            double error;
+            int iterations;
+
+            if (iterativeSolverInfo == default(IterativeSolverInfo))
+            {
+                iterativeSolverInfo = _defaultIterativeSolverInfo;
+            }
+
+            float[] initialGuess = iterativeSolverInfo.HasInitialGuess ?
+                new VectorXF(iterativeSolverInfo.InitialGuess).GetValues().ToArray() : Array.Empty<float>();
+
+            switch (iterativeSolverInfo.Solver)
+            {
+                case IterativeSolverType.BiCGSTAB:
+                    success = EigenSparseUtilities.SolveBiCGSTAB(Rows, Cols, Nnz,
+                       iterativeSolverInfo.MaxIterations, iterativeSolverInfo.Tolerance, (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor, iterativeSolverInfo.DropTolerance, iterativeSolverInfo.Shift,
+                       GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, initialGuess, x,
+                       out iterations, out error);
+                    break;
+                case IterativeSolverType.GMRES:
+                    success = EigenSparseUtilities.SolveGMRES(Rows, Cols, Nnz,
+                       iterativeSolverInfo.MaxIterations, iterativeSolverInfo.Tolerance, (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor, iterativeSolverInfo.DropTolerance, iterativeSolverInfo.Shift,
+                       GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, initialGuess, x,
+                       out iterations, out error);
+                    break;
+                case IterativeSolverType.MINRES:
+                case IterativeSolverType.DGMRES:
+                    success = EigenSparseUtilities.SolveMINRES(Rows, Cols, Nnz,
+                       iterativeSolverInfo.MaxIterations, iterativeSolverInfo.Tolerance, (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor, iterativeSolverInfo.DropTolerance, iterativeSolverInfo.Shift,
+                       GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, initialGuess, x,
+                       out iterations, out error);
+                    break;
+                case IterativeSolverType.LeastSquaresConjugateGradient:
+                    success = EigenSparseUtilities.SolveLeastSquaresConjugateGradient(Rows, Cols, Nnz,
+                       iterativeSolverInfo.MaxIterations, iterativeSolverInfo.Tolerance, (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor, iterativeSolverInfo.DropTolerance, iterativeSolverInfo.Shift,
+                       GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, initialGuess, x,
+                       out iterations, out error);
+                    break;
+                case IterativeSolverType.ConjugateGradient:
+                default:
+                    success = EigenSparseUtilities.SolveConjugateGradient(Rows, Cols, Nnz,
+                       iterativeSolverInfo.MaxIterations, iterativeSolverInfo.Tolerance, (int)iterativeSolverInfo.Preconditioner,
+                       iterativeSolverInfo.FillFactor, iterativeSolverInfo.DropTolerance, iterativeSolverInfo.Shift,
+                       GetOuterStarts(), GetInnerIndices(), GetValues(), other.GetValues(), other.Length, initialGuess, x,
+                       out iterations, out error);
+                    break;
+            }
+
+            return new IterativeSolverResultF(new VectorXF(x), iterations, error, iterativeSolverInfo.Solver, success);
+        }
+
+        public VectorXF DirectSolve(VectorXF other, DirectSolverType directSolverType = DirectSolverType.SparseLU)
+        {
+            float[] x = new float[other.Length];
+            switch (directSolverType)
+            {
+                case DirectSolverType.SimplicialLLT:
+                    EigenSparseUtilities.SolveSimplicialLLT(Rows, Cols, Nnz, GetOuterStarts(),
+                        GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    break;
+                case DirectSolverType.SimplicialLDLT:
+                    EigenSparseUtilities.SolveSimplicialLDLT(Rows, Cols, Nnz, GetOuterStarts(),
+                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    break;
+                case DirectSolverType.SparseQR:
+                    EigenSparseUtilities.SolveSparseQR(Rows, Cols, Nnz, GetOuterStarts(),
+                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    break;
+                case DirectSolverType.SparseLU:
+                default:
+                    EigenSparseUtilities.SolveSparseLU(Rows, Cols, Nnz, GetOuterStarts(),
+                      GetInnerIndices(), GetValues(), other.GetValues(), other.Length, x);
+                    break;
+            }
+
+            return new VectorXF(x);
+        }
+
+        public SparseMatrixD ToDouble()
+        {
+            return new SparseMatrixD(_values.Select(v => (double)v).ToArray(), _innerIndices.ToArray(), _outerStarts.ToArray(), Rows, Cols);
+        }
+
+        public override bool Equals(object value)
+        {
+            if (ReferenceEquals(null, value))
+            {
+                return false;
+            }
+
+            if (ReferenceEquals(this, value))
+            {
+                return true;
+            }
+
+            if (value.GetType() != GetType())
+            {
+                return false;
+            }
+
+            return IsEqual((SparseMatrixF)value);
+        }
+
+        public override int GetHashCode()
+        {
+            return base.GetHashCode();
+        }
+
+        public SparseMatrixF(IList<(int, int, float)> sparseInfo, int rows, int cols)
+            : base(MatrixSparseHelpers.ToCCS(sparseInfo, rows, cols), rows, cols)
+        {
+        }
+
+        public SparseMatrixF(SparseMatrixD matrix)
+            : base(matrix.GetValues().ToArray().Select(v => (float)v).ToArray(), matrix.GetInnerIndices().ToArray(),
+                  matrix.GetOuterStarts().ToArray(), matrix.Rows, matrix.Cols)
+        {
+        }
+
+        public SparseMatrixF(float[] values, int[] innerIndices, int[] outerStarts, int rows, int cols)
+            : base(values, innerIndices, outerStarts, rows, cols)
+        {
+        }
+    }
+}
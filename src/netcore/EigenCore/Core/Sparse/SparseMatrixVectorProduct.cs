@@ -0,0 +1,44 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using EigenCore.Eigen;
+using System;
+
+namespace EigenCore.Core.Sparse
+{
+    /// <summary>
+    /// Native row-major (CSR) copy of a sparse matrix kept alive for repeated matrix-vector products.
+    /// Rows are split across threads by number of nonzeros, following <see cref="EigenThreads"/>.
+    /// </summary>
+    public class SparseMatrixVectorProduct : NativeHandle
+    {
+        public int Rows { get; }
+
+        public int Cols { get; }
+
+        public VectorXD Mult(VectorXD other)
+        {
+            ThrowIfDisposed();
+            if (other.Length != Cols)
+            {
+                throw new ArgumentException($"Expected a vector of length {Cols}.", nameof(other));
+            }
+
+            double[] values = new double[Rows];
+            EigenSparseUtilities.MultiplierMultiply(Handle, other.GetValues(), values);
+            return new VectorXD(values);
+        }
+
+        protected override void ReleaseHandle(IntPtr handle)
+        {
+            EigenSparseUtilities.MultiplierDestroy(handle);
+        }
+
+        internal SparseMatrixVectorProduct(SparseMatrixD matrix)
+            : base(EigenSparseUtilities.MultiplierCreate(matrix.Rows, matrix.Cols, matrix.Nnz,
+                matrix.GetOuterStarts(), matrix.GetInnerIndices(), matrix.GetValues()))
+        {
+            Rows = matrix.Rows;
+            Cols = matrix.Cols;
+        }
+    }
+}
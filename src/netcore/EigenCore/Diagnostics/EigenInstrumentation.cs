@@ -0,0 +1,63 @@
+﻿using EigenCore.Eigen;
+using System;
+using System.Collections.Generic;
+
+namespace EigenCore.Diagnostics
+{
+    /// <summary>
+    /// Call counters and latency histograms the native library keeps for every export, bucketed
+    /// by problem size. Each thread counts into its own block without locks, a snapshot merges
+    /// the blocks of all threads. Nothing is recorded when the native library was built with
+    /// EIGEN_CORE_INSTRUMENTATION=OFF.
+    /// </summary>
+    public static class EigenInstrumentation
+    {
+        // must match instrument_size_buckets and instrument_latency_buckets in EigenNative.cpp.
+        public const int SizeBuckets = 16;
+        public const int LatencyBuckets = 32;
+
+        /// <summary>
+        /// Process-wide switch, disabling skips the two clock reads per call; counts are kept.
+        /// </summary>
+        public static bool Enabled
+        {
+            get => EigenSharedUtilities.InstrumentationEnabled();
+            set => EigenSharedUtilities.InstrumentationSetEnabled(value);
+        }
+
+        /// <summary>
+        /// Counters of every export and size bucket called since the last <see cref="Reset"/>,
+        /// ordered by export in order of first call and by size bucket.
+        /// </summary>
+        /// <returns></returns>
+        public static IReadOnlyList<EntryPointStatistics> Snapshot()
+        {
+            IntPtr handle = EigenSharedUtilities.InstrumentationSnapshot(out int count);
+            try
+            {
+                var result = new EntryPointStatistics[count];
+                Span<long> stats = stackalloc long[4];
+                for (int i = 0; i < count; i++)
+                {
+                    long[] histogram = new long[LatencyBuckets];
+                    string name = EigenSharedUtilities.InstrumentationSnapshotEntry(handle, i, out int sizeBucket, stats, histogram);
+                    result[i] = new EntryPointStatistics(name, sizeBucket, stats[0], stats[1], stats[2], stats[3], histogram);
+                }
+
+                return result;
+            }
+            finally
+            {
+                EigenSharedUtilities.InstrumentationSnapshotDestroy(handle);
+            }
+        }
+
+        /// <summary>
+        /// Clears the counters of every thread.
+        /// </summary>
+        public static void Reset()
+        {
+            EigenSharedUtilities.InstrumentationReset();
+        }
+    }
+}
@@ -0,0 +1,90 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace EigenCore.Diagnostics
+{
+    /// <summary>
+    /// Calls of one native export with a problem size in one bucket. The size is the number of
+    /// non zeros for sparse inputs and rows * cols otherwise, bucket k holds sizes in [4^k, 4^(k+1)).
+    /// </summary>
+    public sealed class EntryPointStatistics
+    {
+        private readonly long[] _histogram;
+
+        internal EntryPointStatistics(string name, int sizeBucket, long count, long totalNanoseconds,
+            long minNanoseconds, long maxNanoseconds, long[] histogram)
+        {
+            Name = name;
+            SizeBucket = sizeBucket;
+            Count = count;
+            TotalNanoseconds = totalNanoseconds;
+            MinNanoseconds = minNanoseconds;
+            MaxNanoseconds = maxNanoseconds;
+            _histogram = histogram;
+        }
+
+        /// <summary>
+        /// Native export, e.g. "dmult_".
+        /// </summary>
+        public string Name { get; }
+
+        public int SizeBucket { get; }
+
+        /// <summary>
+        /// Smallest problem size of the bucket.
+        /// </summary>
+        public long MinSize => SizeBucket == 0 ? 0 : 1L << (2 * SizeBucket);
+
+        /// <summary>
+        /// Exclusive upper bound of the problem size, long.MaxValue for the last bucket.
+        /// </summary>
+        public long MaxSize => SizeBucket == EigenInstrumentation.SizeBuckets - 1 ? long.MaxValue : 1L << (2 * SizeBucket + 2);
+
+        public long Count { get; }
+
+        public long TotalNanoseconds { get; }
+
+        public long MinNanoseconds { get; }
+
+        public long MaxNanoseconds { get; }
+
+        public TimeSpan TotalTime => FromNanoseconds(TotalNanoseconds);
+
+        public TimeSpan MinTime => FromNanoseconds(MinNanoseconds);
+
+        public TimeSpan MaxTime => FromNanoseconds(MaxNanoseconds);
+
+        public TimeSpan MeanTime => FromNanoseconds(TotalNanoseconds / Count);
+
+        /// <summary>
+        /// Number of calls per latency bucket, see <see cref="LatencyUpperBound(int)"/>.
+        /// </summary>
+        public IReadOnlyList<long> Histogram => _histogram;
+
+        /// <summary>
+        /// Exclusive upper bound of a latency bucket: bucket 0 holds calls under 2 microseconds,
+        /// bucket k those in [2^k, 2^(k+1)) microseconds and the last bucket everything longer.
+        /// </summary>
+        /// <param name="bucket"></param>
+        /// <returns></returns>
+        public static TimeSpan LatencyUpperBound(int bucket)
+        {
+            if (bucket < 0 || bucket >= EigenInstrumentation.LatencyBuckets)
+            {
+                throw new ArgumentOutOfRangeException(nameof(bucket));
+            }
+
+            return bucket == EigenInstrumentation.LatencyBuckets - 1 ? TimeSpan.MaxValue : TimeSpan.FromTicks((1L << (bucket + 1)) * 10);
+        }
+
+        public override string ToString()
+        {
+            return $"{Name} [{MinSize}, {MaxSize}): {Count} calls, mean {MeanTime.TotalMilliseconds} ms";
+        }
+
+        private static TimeSpan FromNanoseconds(long nanoseconds)
+        {
+            return TimeSpan.FromTicks(nanoseconds / 100);
+        }
+    }
+}
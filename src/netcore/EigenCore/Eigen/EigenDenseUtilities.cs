@@ -105,6 +105,96 @@ namespace EigenCore.Eigen
             }
         }
 
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Axpy(double alpha, ReadOnlySpan<double> vector, int length, Span<double> inoutVector)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(vector))
+                {
+                    fixed (double* pInOut = &MemoryMarshal.GetReference(inoutVector))
+                    {
+                        ThunkDenseEigen.dvaxpy_(alpha, pfirst, length, pInOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Axpby(double alpha, ReadOnlySpan<double> vector, double beta, int length, Span<double> inoutVector)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(vector))
+                {
+                    fixed (double* pInOut = &MemoryMarshal.GetReference(inoutVector))
+                    {
+                        ThunkDenseEigen.dvaxpby_(alpha, pfirst, beta, length, pInOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Scal(double alpha, int length, Span<double> inoutVector)
+        {
+            unsafe
+            {
+                fixed (double* pInOut = &MemoryMarshal.GetReference(inoutVector))
+                {
+                    ThunkDenseEigen.dvscal_(alpha, length, pInOut);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Copy(ReadOnlySpan<double> vector, int length, Span<double> outVector)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(vector))
+                {
+                    fixed (double* pOut = &MemoryMarshal.GetReference(outVector))
+                    {
+                        ThunkDenseEigen.dvcopy_(pfirst, length, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static double DotSquaredNorm(ReadOnlySpan<double> firstVector, ReadOnlySpan<double> secondVector, int length, out double squaredNorm)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstVector))
+                {
+                    fixed (double* pSecond = &MemoryMarshal.GetReference(secondVector))
+                    {
+                        double norm;
+                        double dot = ThunkDenseEigen.dvdot_squared_norm_(pfirst, pSecond, length, &norm);
+                        squaredNorm = norm;
+                        return dot;
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static double ConjugateGradientUpdate(double alpha, ReadOnlySpan<double> p, ReadOnlySpan<double> q, int length, Span<double> x, Span<double> r)
+        {
+            unsafe
+            {
+                fixed (double* pP = &MemoryMarshal.GetReference(p), pQ = &MemoryMarshal.GetReference(q))
+                {
+                    fixed (double* pX = &MemoryMarshal.GetReference(x), pR = &MemoryMarshal.GetReference(r))
+                    {
+                        return ThunkDenseEigen.dvcg_update_(alpha, pP, pQ, length, pX, pR);
+                    }
+                }
+            }
+        }
+
         #endregion Vectors
 
         #region Matrices
@@ -151,6 +241,28 @@ namespace EigenCore.Eigen
             }
         }
 
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Gemm(
+                ReadOnlySpan<double> firstMatrix, int rows1, int cols1, bool transpose1,
+                ReadOnlySpan<double> secondMatrix, int rows2, int cols2, bool transpose2,
+                double alpha, double beta,
+                Span<double> outMatrix)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (double* pSecond = &MemoryMarshal.GetReference(secondMatrix))
+                    {
+                        fixed (double* pOut = &MemoryMarshal.GetReference(outMatrix))
+                        {
+                            ThunkDenseEigen.dgemm_(pfirst, rows1, cols1, transpose1 ? 1 : 0, pSecond, rows2, cols2, transpose2 ? 1 : 0, alpha, beta, pOut);
+                        }
+                    }
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static double Norm(
         ReadOnlySpan<double> firstMatrix,
@@ -510,6 +622,33 @@ namespace EigenCore.Eigen
             }
         }
 
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int SVDRandomized(ReadOnlySpan<double> firstMatrix, int rows1, int cols1,
+            int rank,
+            int oversampling,
+            int powerIterations,
+            Span<double> uout,
+            Span<double> sout,
+            Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (double* pUOut = &MemoryMarshal.GetReference(uout))
+                    {
+                        fixed (double* pSOut = &MemoryMarshal.GetReference(sout))
+                        {
+                            fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                            {
+                                return ThunkDenseEigen.dsvd_randomized_(pfirst, rows1, cols1, rank, oversampling, powerIterations, pUOut, pSOut, pVOut);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static void NormalEquationsLeastSquares(ReadOnlySpan<double> firstMatrix, int rows1, int cols1,
             ReadOnlySpan<double> rhs,
@@ -791,5 +930,480 @@ namespace EigenCore.Eigen
         }
 
         #endregion Matrices
+
+        #region Factorizations
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveCompleteOrthogonalDecomposition(ReadOnlySpan<double> firstMatrix,
+                int rows1,
+                int cols1,
+                ReadOnlySpan<double> rhs,
+                Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkDenseEigen.dsolve_completeOrthogonalDecomposition_(pfirst, rows1, cols1, prhs, pVOut);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr FactorizationCreate(int solverType)
+        {
+            return ThunkDenseEigen.dfactorization_create_(solverType);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool FactorizationCompute(IntPtr handle, ReadOnlySpan<double> firstMatrix, int rows1, int cols1)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    return ThunkDenseEigen.dfactorization_compute_(handle, pfirst, rows1, cols1);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationSolve(IntPtr handle, ReadOnlySpan<double> rhs, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dfactorization_solve_(handle, prhs, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationSolveTranspose(IntPtr handle, ReadOnlySpan<double> rhs, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dfactorization_solveTranspose_(handle, prhs, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static double FactorizationDeterminant(IntPtr handle)
+        {
+            return ThunkDenseEigen.dfactorization_determinant_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static double FactorizationLogAbsDeterminant(IntPtr handle)
+        {
+            return ThunkDenseEigen.dfactorization_logAbsDeterminant_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationDestroy(IntPtr handle)
+        {
+            ThunkDenseEigen.dfactorization_destroy_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveBlock(int solverType,
+                ReadOnlySpan<double> firstMatrix,
+                int rows1,
+                int cols1,
+                ReadOnlySpan<double> rhs,
+                int rhsCols,
+                Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkDenseEigen.dsolve_block_(solverType, pfirst, rows1, cols1, prhs, rhsCols, pVOut);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveMixedPrecision(int solverType,
+                ReadOnlySpan<double> firstMatrix,
+                int rows1,
+                int cols1,
+                ReadOnlySpan<double> rhs,
+                Span<double> vout,
+                out int steps)
+        {
+            unsafe
+            {
+                fixed (double* pfirst = &MemoryMarshal.GetReference(firstMatrix), prhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        int stepsOut;
+                        bool result = ThunkDenseEigen.dsolve_mixedPrecision_(solverType, pfirst, rows1, cols1, prhs, pVOut, &stepsOut);
+                        steps = stepsOut;
+                        return result;
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationSolveBlock(IntPtr handle, ReadOnlySpan<double> rhs, int rhsCols, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dfactorization_solveBlock_(handle, prhs, rhsCols, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationSolveTransposeBlock(IntPtr handle, ReadOnlySpan<double> rhs, int rhsCols, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* prhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dfactorization_solveTransposeBlock_(handle, prhs, rhsCols, pVOut);
+                    }
+                }
+            }
+        }
+
+        #endregion Factorizations
+
+        #region Batches
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void BatchMult(int layout, int size, int count, ReadOnlySpan<double> first, ReadOnlySpan<double> second, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pFirst = &MemoryMarshal.GetReference(first), pSecond = &MemoryMarshal.GetReference(second))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dbatch_mult_(layout, size, count, pFirst, pSecond, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void BatchInverse(int layout, int size, int count, ReadOnlySpan<double> matrices, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pMatrices = &MemoryMarshal.GetReference(matrices))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dbatch_inverse_(layout, size, count, pMatrices, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void BatchDeterminant(int layout, int size, int count, ReadOnlySpan<double> matrices, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pMatrices = &MemoryMarshal.GetReference(matrices))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dbatch_determinant_(layout, size, count, pMatrices, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void BatchSolve(int layout, int size, int count, ReadOnlySpan<double> first, ReadOnlySpan<double> second, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pFirst = &MemoryMarshal.GetReference(first), pSecond = &MemoryMarshal.GetReference(second))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.dbatch_solve_(layout, size, count, pFirst, pSecond, pVOut);
+                    }
+                }
+            }
+        }
+
+        #endregion Batches
+
+        #region Single precision
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Dot(ReadOnlySpan<float> firstVector, ReadOnlySpan<float> secondVector, int length)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstVector), pSecond = &MemoryMarshal.GetReference(secondVector))
+                {
+                    return ThunkDenseEigen.fdot_(pFirst, pSecond, length);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Add(ReadOnlySpan<float> firstVector, ReadOnlySpan<float> secondVector, int length, Span<float> outVector)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstVector), pSecond = &MemoryMarshal.GetReference(secondVector))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(outVector))
+                    {
+                        ThunkDenseEigen.fadd_(pFirst, pSecond, length, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Scale(ReadOnlySpan<float> firstVector, float scale, int length, Span<float> outVector)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstVector))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(outVector))
+                    {
+                        ThunkDenseEigen.fscale_(pFirst, scale, length, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Norm(ReadOnlySpan<float> firstVector, int length)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstVector))
+                {
+                    return ThunkDenseEigen.fvnorm_(pFirst, length);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float SquaredNorm(ReadOnlySpan<float> firstVector, int length)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstVector))
+                {
+                    return ThunkDenseEigen.fvsquared_norm_(pFirst, length);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Minus(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> secondMatrix, int rows2, int cols2, Span<float> mout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pSecond = &MemoryMarshal.GetReference(secondMatrix))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(mout))
+                    {
+                        ThunkDenseEigen.fminus_(pFirst, rows1, cols1, pSecond, rows2, cols2, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Mult(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> secondMatrix, int rows2, int cols2, Span<float> mout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pSecond = &MemoryMarshal.GetReference(secondMatrix))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(mout))
+                    {
+                        ThunkDenseEigen.fmult_(pFirst, rows1, cols1, pSecond, rows2, cols2, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Mult(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> vector, int length, Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pSecond = &MemoryMarshal.GetReference(vector))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.fmultv_(pFirst, rows1, cols1, pSecond, length, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Transpose(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, Span<float> mout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(mout))
+                    {
+                        ThunkDenseEigen.ftransp_(pFirst, rows1, cols1, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Trace(ReadOnlySpan<float> firstMatrix, int rows1, int cols1)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    return ThunkDenseEigen.ftrace_(pFirst, rows1, cols1);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Norm(ReadOnlySpan<float> firstMatrix, int rows1, int cols1)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    return ThunkDenseEigen.fnorm_(pFirst, rows1, cols1);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Determinant(ReadOnlySpan<float> firstMatrix, int rows1, int cols1)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    return ThunkDenseEigen.fdeterminant_(pFirst, rows1, cols1);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Inverse(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, Span<float> mout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(mout))
+                    {
+                        ThunkDenseEigen.finverse_(pFirst, rows1, cols1, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveColPivHouseholderQr(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> rhs, Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.fsolve_colPivHouseholderQr_(pFirst, rows1, cols1, pRhs, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolvePartialPivLU(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> rhs, Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.fsolve_partialPivLU_(pFirst, rows1, cols1, pRhs, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveLLT(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> rhs, Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.fsolve_llt_(pFirst, rows1, cols1, pRhs, pOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveLDLT(ReadOnlySpan<float> firstMatrix, int rows1, int cols1, ReadOnlySpan<float> rhs, Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (float* pFirst = &MemoryMarshal.GetReference(firstMatrix), pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (float* pOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkDenseEigen.fsolve_ldlt_(pFirst, rows1, cols1, pRhs, pOut);
+                    }
+                }
+            }
+        }
+
+        #endregion Single precision
     }
 }
@@ -0,0 +1,282 @@
+﻿using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace EigenCore.Eigen
+{
+    internal static class EigenSharedUtilities
+    {
+        #region Threading
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SetNumThreads(int threads)
+        {
+            ThunkSharedEigen.set_num_threads_(threads);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int GetNumThreads()
+        {
+            return ThunkSharedEigen.get_num_threads_();
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SetThreadBudget(int threads)
+        {
+            ThunkSharedEigen.set_thread_budget_(threads);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int GetThreadBudget()
+        {
+            return ThunkSharedEigen.get_thread_budget_();
+        }
+
+        #endregion
+
+        #region Instruction sets
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static string SimdInstructionSetsInUse()
+        {
+            return Marshal.PtrToStringAnsi(ThunkSharedEigen.simd_instruction_sets_in_use_());
+        }
+
+        #endregion
+
+        #region Instrumentation
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void InstrumentationSetEnabled(bool enabled)
+        {
+            ThunkSharedEigen.instrumentation_set_enabled_(enabled);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool InstrumentationEnabled()
+        {
+            return ThunkSharedEigen.instrumentation_enabled_();
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void InstrumentationReset()
+        {
+            ThunkSharedEigen.instrumentation_reset_();
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr InstrumentationSnapshot(out int count)
+        {
+            unsafe
+            {
+                int countOut;
+                IntPtr handle = ThunkSharedEigen.instrumentation_snapshot_(&countOut);
+                count = countOut;
+                return handle;
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static string InstrumentationSnapshotEntry(IntPtr handle, int index, out int sizeBucket, Span<long> stats, Span<long> histogram)
+        {
+            unsafe
+            {
+                int sizeBucketOut;
+                fixed (long* pStats = &MemoryMarshal.GetReference(stats), pHistogram = &MemoryMarshal.GetReference(histogram))
+                {
+                    IntPtr name = ThunkSharedEigen.instrumentation_snapshot_entry_(handle, index, &sizeBucketOut, pStats, pHistogram);
+                    sizeBucket = sizeBucketOut;
+                    return Marshal.PtrToStringAnsi(name);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void InstrumentationSnapshotDestroy(IntPtr handle)
+        {
+            ThunkSharedEigen.instrumentation_snapshot_destroy_(handle);
+        }
+
+        #endregion
+
+        #region Matrix Market
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr MatrixMarketRead(string path)
+        {
+            return ThunkSharedEigen.matrixmarket_read_(path);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int MatrixMarketInfo(IntPtr handle, out int format, out int rows, out int cols, out int nnz)
+        {
+            unsafe
+            {
+                int formatOut, rowsOut, colsOut, nnzOut;
+                int status = ThunkSharedEigen.matrixmarket_info_(handle, &formatOut, &rowsOut, &colsOut, &nnzOut);
+                format = formatOut;
+                rows = rowsOut;
+                cols = colsOut;
+                nnz = nnzOut;
+                return status;
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static string MatrixMarketError(IntPtr handle)
+        {
+            return Marshal.PtrToStringUTF8(ThunkSharedEigen.matrixmarket_error_(handle));
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MatrixMarketSparse(IntPtr handle, Span<int> outerIndex, Span<int> innerIndex, Span<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        ThunkSharedEigen.matrixmarket_sparse_(handle, pOuterIndex, pInnerIndex, pValues);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MatrixMarketDense(IntPtr handle, Span<double> values)
+        {
+            unsafe
+            {
+                fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                {
+                    ThunkSharedEigen.matrixmarket_dense_(handle, pValues);
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MatrixMarketDestroy(IntPtr handle)
+        {
+            ThunkSharedEigen.matrixmarket_destroy_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool MatrixMarketWrite(string path, int rows, int cols, int nnz,
+            ReadOnlySpan<int> outerIndex, ReadOnlySpan<int> innerIndex, ReadOnlySpan<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        return ThunkSharedEigen.smatrixmarket_write_(path, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool MatrixMarketWrite(string path, ReadOnlySpan<double> values, int rows, int cols)
+        {
+            unsafe
+            {
+                fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                {
+                    return ThunkSharedEigen.dmatrixmarket_write_(path, pValues, rows, cols);
+                }
+            }
+        }
+
+        #endregion
+
+        #region Binary Matrix File
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr MatrixFileOpen(string path)
+        {
+            return ThunkSharedEigen.matrixfile_open_(path);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int MatrixFileInfo(IntPtr handle, out int kind, out int rows, out int cols, out int nnz)
+        {
+            unsafe
+            {
+                int kindOut, rowsOut, colsOut, nnzOut;
+                int status = ThunkSharedEigen.matrixfile_info_(handle, &kindOut, &rowsOut, &colsOut, &nnzOut);
+                kind = kindOut;
+                rows = rowsOut;
+                cols = colsOut;
+                nnz = nnzOut;
+                return status;
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static string MatrixFileError(IntPtr handle)
+        {
+            return Marshal.PtrToStringUTF8(ThunkSharedEigen.matrixfile_error_(handle));
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MatrixFileSparse(IntPtr handle, out IntPtr outerIndex, out IntPtr innerIndex, out IntPtr values)
+        {
+            unsafe
+            {
+                int* pOuterIndex, pInnerIndex;
+                double* pValues;
+                ThunkSharedEigen.matrixfile_sparse_(handle, &pOuterIndex, &pInnerIndex, &pValues);
+                outerIndex = (IntPtr)pOuterIndex;
+                innerIndex = (IntPtr)pInnerIndex;
+                values = (IntPtr)pValues;
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr MatrixFileDense(IntPtr handle)
+        {
+            unsafe
+            {
+                return (IntPtr)ThunkSharedEigen.matrixfile_dense_(handle);
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MatrixFileClose(IntPtr handle)
+        {
+            ThunkSharedEigen.matrixfile_close_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool MatrixFileWrite(string path, int rows, int cols, int nnz,
+            ReadOnlySpan<int> outerIndex, ReadOnlySpan<int> innerIndex, ReadOnlySpan<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        return ThunkSharedEigen.smatrixfile_write_(path, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool MatrixFileWrite(string path, ReadOnlySpan<double> values, int rows, int cols)
+        {
+            unsafe
+            {
+                fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                {
+                    return ThunkSharedEigen.dmatrixfile_write_(path, pValues, rows, cols);
+                }
+            }
+        }
+
+        #endregion
+    }
+}
@@ -1,4 +1,5 @@
-﻿using System;
+﻿using EigenCore.Core.Sparse.LinearAlgebra;
+using System;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 
@@ -13,14 +14,20 @@ namespace EigenCore.Eigen
         int nnz,
         int maxIterations,
         double tolerance,
+        int preconditioner,
+        int fillFactor,
+        double dropTolerance,
+        double shift,
         ReadOnlySpan<int> outerIndex,
         ReadOnlySpan<int> innerIndex,
         ReadOnlySpan<double> values,
         ReadOnlySpan<double> rhs,
         int size,
+        ReadOnlySpan<double> initialGuess,
         Span<double> vout,
         out int iterations,
-        out double error)
+        out double error,
+        IntPtr monitor)
         {
             unsafe
             {
@@ -32,11 +39,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_conjugateGradient_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_conjugateGradient_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -55,14 +63,20 @@ namespace EigenCore.Eigen
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             ReadOnlySpan<int> outerIndex,
             ReadOnlySpan<int> innerIndex,
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
+            ReadOnlySpan<double> initialGuess,
             Span<double> vout,
             out int iterations,
-            out double error)
+            out double error,
+            IntPtr monitor)
         {
             unsafe
             {
@@ -74,11 +88,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_biCGSTAB_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_biCGSTAB_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -97,14 +112,20 @@ namespace EigenCore.Eigen
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             ReadOnlySpan<int> outerIndex,
             ReadOnlySpan<int> innerIndex,
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
+            ReadOnlySpan<double> initialGuess,
             Span<double> vout,
             out int iterations,
-            out double error)
+            out double error,
+            IntPtr monitor)
         {
             unsafe
             {
@@ -116,11 +137,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_LeastSquaresConjugateGradient_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_LeastSquaresConjugateGradient_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -139,14 +161,20 @@ namespace EigenCore.Eigen
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             ReadOnlySpan<int> outerIndex,
             ReadOnlySpan<int> innerIndex,
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
+            ReadOnlySpan<double> initialGuess,
             Span<double> vout,
             out int iterations,
-            out double error)
+            out double error,
+            IntPtr monitor)
         {
             unsafe
             {
@@ -158,11 +186,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_GMRES_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_GMRES_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -181,14 +210,20 @@ namespace EigenCore.Eigen
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             ReadOnlySpan<int> outerIndex,
             ReadOnlySpan<int> innerIndex,
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
+            ReadOnlySpan<double> initialGuess,
             Span<double> vout,
             out int iterations,
-            out double error)
+            out double error,
+            IntPtr monitor)
         {
             unsafe
             {
@@ -200,11 +235,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_MINRES_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_MINRES_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -223,14 +259,20 @@ namespace EigenCore.Eigen
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             ReadOnlySpan<int> outerIndex,
             ReadOnlySpan<int> innerIndex,
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
+            ReadOnlySpan<double> initialGuess,
             Span<double> vout,
             out int iterations,
-            out double error)
+            out double error,
+            IntPtr monitor)
         {
             unsafe
             {
@@ -242,11 +284,12 @@ namespace EigenCore.Eigen
                     {
                         fixed (double* pValues = &MemoryMarshal.GetReference(values))
                         {
-                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
                             {
+                                double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    bool result = ThunkSparseEigen.ssolve_DGMRES_(rows, cols, nnz, maxIterations, tolerance, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &iterationsOut, &errorOut);
+                                    bool result = ThunkSparseEigen.ssolve_DGMRES_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
                                     iterations = iterationsOut;
                                     error = errorOut;
                                     return result;
@@ -258,6 +301,60 @@ namespace EigenCore.Eigen
             }
         }
 
+        /// <summary>
+        /// Compressed column storage of count triplets with duplicates summed, innerIndex and
+        /// valuesOut must hold count entries. Returns the number of non zeros.
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int FromTriplets(
+            int rows,
+            int cols,
+            int count,
+            ReadOnlySpan<int> rowIndices,
+            ReadOnlySpan<int> colIndices,
+            ReadOnlySpan<double> values,
+            Span<int> outerIndex,
+            Span<int> innerIndex,
+            Span<double> valuesOut)
+        {
+            unsafe
+            {
+                fixed (int* pRowIndices = &MemoryMarshal.GetReference(rowIndices), pColIndices = &MemoryMarshal.GetReference(colIndices),
+                    pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values), pValuesOut = &MemoryMarshal.GetReference(valuesOut))
+                    {
+                        return ThunkSparseEigen.sfrom_triplets_(rows, cols, count, pRowIndices, pColIndices, pValues, pOuterIndex, pInnerIndex, pValuesOut);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Symbolic phase of <see cref="ADD"/> and <see cref="Minus"/>, fills the exact
+        /// column pointers of the result and returns its number of non zeros.
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int AddSymbolic(
+            int rows,
+            int cols,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<int> outerIndex2,
+            ReadOnlySpan<int> innerIndex2,
+            Span<int> outerIndex)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1),
+                    pOuterIndex2 = &MemoryMarshal.GetReference(outerIndex2), pInnerIndex2 = &MemoryMarshal.GetReference(innerIndex2),
+                    pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    return ThunkSparseEigen.sadd_symbolic_(rows, cols, pOuterIndex1, pInnerIndex1, pOuterIndex2, pInnerIndex2, pOuterIndex);
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static void ADD(
         int rows,
@@ -270,10 +367,9 @@ namespace EigenCore.Eigen
         ReadOnlySpan<int> outerIndex2,
         ReadOnlySpan<int> innerIndex2,
         ReadOnlySpan<double> values2,
-        Span<int> outerIndex,
+        ReadOnlySpan<int> outerIndex,
         Span<int> innerIndex,
-        Span<double> values,
-        out int nnz)
+        Span<double> values)
         {
             unsafe
             {
@@ -296,13 +392,10 @@ namespace EigenCore.Eigen
                                             {
                                                 fixed (double* pValues2 = &MemoryMarshal.GetReference(values2))
                                                 {
-                                                    int outNnz;
                                                     ThunkSparseEigen.sadd_(rows, cols,
                                                     nnz1, pOuterIndex1, pInnerIndex1, pValues1,
                                                     nnz2, pOuterIndex2, pInnerIndex2, pValues2,
-                                                    &outNnz, pOuterIndex, pInnerIndex, pValues);
-
-                                                    nnz = outNnz;
+                                                    pOuterIndex, pInnerIndex, pValues);
                                                 }
                                             }
                                         }
@@ -327,10 +420,9 @@ namespace EigenCore.Eigen
                ReadOnlySpan<int> outerIndex2,
                ReadOnlySpan<int> innerIndex2,
                ReadOnlySpan<double> values2,
-               Span<int> outerIndex,
+               ReadOnlySpan<int> outerIndex,
                Span<int> innerIndex,
-               Span<double> values,
-               out int nnz)
+               Span<double> values)
         {
             unsafe
             {
@@ -353,13 +445,10 @@ namespace EigenCore.Eigen
                                             {
                                                 fixed (double* pValues2 = &MemoryMarshal.GetReference(values2))
                                                 {
-                                                    int outNnz;
                                                     ThunkSparseEigen.sminus_(rows, cols,
                                                     nnz1, pOuterIndex1, pInnerIndex1, pValues1,
                                                     nnz2, pOuterIndex2, pInnerIndex2, pValues2,
-                                                    &outNnz, pOuterIndex, pInnerIndex, pValues);
-
-                                                    nnz = outNnz;
+                                                    pOuterIndex, pInnerIndex, pValues);
                                                 }
                                             }
                                         }
@@ -372,9 +461,36 @@ namespace EigenCore.Eigen
             }
         }
 
+        /// <summary>
+        /// Symbolic phase of the sparse product, fills the exact column pointers of the
+        /// result and returns its number of non zeros.
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int MultSymbolic(
+            int rows,
+            int inner,
+            int cols,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<int> outerIndex2,
+            ReadOnlySpan<int> innerIndex2,
+            Span<int> outerIndex)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1),
+                    pOuterIndex2 = &MemoryMarshal.GetReference(outerIndex2), pInnerIndex2 = &MemoryMarshal.GetReference(innerIndex2),
+                    pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    return ThunkSparseEigen.smult_symbolic_(rows, inner, cols, pOuterIndex1, pInnerIndex1, pOuterIndex2, pInnerIndex2, pOuterIndex);
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static void Mult(
               int rows,
+              int inner,
               int cols,
               int nnz1,
               ReadOnlySpan<int> outerIndex1,
@@ -384,10 +500,9 @@ namespace EigenCore.Eigen
               ReadOnlySpan<int> outerIndex2,
               ReadOnlySpan<int> innerIndex2,
               ReadOnlySpan<double> values2,
-              Span<int> outerIndex,
+              ReadOnlySpan<int> outerIndex,
               Span<int> innerIndex,
-              Span<double> values,
-              out int nnz)
+              Span<double> values)
         {
             unsafe
             {
@@ -410,13 +525,10 @@ namespace EigenCore.Eigen
                                             {
                                                 fixed (double* pValues2 = &MemoryMarshal.GetReference(values2))
                                                 {
-                                                    int outNnz;
-                                                    ThunkSparseEigen.smult_(rows, cols,
+                                                    ThunkSparseEigen.smult_(rows, inner, cols,
                                                     nnz1, pOuterIndex1, pInnerIndex1, pValues1,
                                                     nnz2, pOuterIndex2, pInnerIndex2, pValues2,
-                                                    &outNnz, pOuterIndex, pInnerIndex, pValues);
-
-                                                    nnz = outNnz;
+                                                    pOuterIndex, pInnerIndex, pValues);
                                                 }
                                             }
                                         }
@@ -429,6 +541,50 @@ namespace EigenCore.Eigen
             }
         }
 
+        /// <summary>
+        /// Numeric phase of the sparse product that drops entries with magnitude &lt;= dropTolerance,
+        /// outerIndex is rewritten for the pruned result. Returns the number of non zeros kept.
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int MultPruned(
+            int rows,
+            int inner,
+            int cols,
+            int nnz1,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<double> values1,
+            int nnz2,
+            ReadOnlySpan<int> outerIndex2,
+            ReadOnlySpan<int> innerIndex2,
+            ReadOnlySpan<double> values2,
+            double dropTolerance,
+            Span<int> outerIndex,
+            Span<int> innerIndex,
+            Span<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1),
+                    pOuterIndex2 = &MemoryMarshal.GetReference(outerIndex2), pInnerIndex2 = &MemoryMarshal.GetReference(innerIndex2))
+                {
+                    fixed (double* pValues1 = &MemoryMarshal.GetReference(values1), pValues2 = &MemoryMarshal.GetReference(values2))
+                    {
+                        fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                        {
+                            fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                            {
+                                return ThunkSparseEigen.smult_pruned_(rows, inner, cols,
+                                    nnz1, pOuterIndex1, pInnerIndex1, pValues1,
+                                    nnz2, pOuterIndex2, pInnerIndex2, pValues2,
+                                    dropTolerance, pOuterIndex, pInnerIndex, pValues);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static void Mult(
               int row,
@@ -506,7 +662,7 @@ namespace EigenCore.Eigen
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static void SolveSimplicialLDLT(
+        public static int SolveSimplicialLDLT(
             int rows,
             int cols,
             int nnz,
@@ -515,10 +671,12 @@ namespace EigenCore.Eigen
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
-            Span<double> vout)
+            Span<double> vout,
+            out DirectSolverStats stats)
         {
             unsafe
             {
+                DirectSolverStats statsOut;
                 fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
                 {
                     fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
@@ -529,7 +687,9 @@ namespace EigenCore.Eigen
                             {
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    ThunkSparseEigen.ssolve_simplicialLDLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut);
+                                    int info = ThunkSparseEigen.ssolve_simplicialLDLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &statsOut);
+                                    stats = statsOut;
+                                    return info;
                                 }
                             }
                         }
@@ -539,7 +699,7 @@ namespace EigenCore.Eigen
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static void SolveSparseLU(
+        public static int SolveSparseLU(
             int rows,
             int cols,
             int nnz,
@@ -548,10 +708,12 @@ namespace EigenCore.Eigen
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
-            Span<double> vout)
+            Span<double> vout,
+            out DirectSolverStats stats)
         {
             unsafe
             {
+                DirectSolverStats statsOut;
                 fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
                 {
                     fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
@@ -562,7 +724,9 @@ namespace EigenCore.Eigen
                             {
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    ThunkSparseEigen.ssolve_sparseLU_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut);
+                                    int info = ThunkSparseEigen.ssolve_sparseLU_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &statsOut);
+                                    stats = statsOut;
+                                    return info;
                                 }
                             }
                         }
@@ -573,7 +737,7 @@ namespace EigenCore.Eigen
 
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static void SolveSparseQR(
+        public static int SolveSparseQR(
             int rows,
             int cols,
             int nnz,
@@ -582,10 +746,12 @@ namespace EigenCore.Eigen
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
-            Span<double> vout)
+            Span<double> vout,
+            out DirectSolverStats stats)
         {
             unsafe
             {
+                DirectSolverStats statsOut;
                 fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
                 {
                     fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
@@ -596,7 +762,9 @@ namespace EigenCore.Eigen
                             {
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    ThunkSparseEigen.ssolve_sparseQR_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut);
+                                    int info = ThunkSparseEigen.ssolve_sparseQR_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &statsOut);
+                                    stats = statsOut;
+                                    return info;
                                 }
                             }
                         }
@@ -606,7 +774,7 @@ namespace EigenCore.Eigen
         }
 
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static void SolveSimplicialLLT(
+        public static int SolveSimplicialLLT(
             int rows,
             int cols,
             int nnz,
@@ -615,10 +783,12 @@ namespace EigenCore.Eigen
             ReadOnlySpan<double> values,
             ReadOnlySpan<double> rhs,
             int size,
-            Span<double> vout)
+            Span<double> vout,
+            out DirectSolverStats stats)
         {
             unsafe
             {
+                DirectSolverStats statsOut;
                 fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
                 {
                     fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
@@ -629,7 +799,9 @@ namespace EigenCore.Eigen
                             {
                                 fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
                                 {
-                                    ThunkSparseEigen.ssolve_simplicialLLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut);
+                                    int info = ThunkSparseEigen.ssolve_simplicialLLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &statsOut);
+                                    stats = statsOut;
+                                    return info;
                                 }
                             }
                         }
@@ -785,5 +957,895 @@ namespace EigenCore.Eigen
                 }
             }
         }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr IterativeSolverCreate(int solverType, int preconditioner)
+        {
+            return ThunkSparseEigen.siterative_create_(solverType, preconditioner);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool IterativeSolverCompute(
+            IntPtr handle,
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values,
+            int fillFactor,
+            double dropTolerance,
+            double shift)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                    {
+                        fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                        {
+                            return ThunkSparseEigen.siterative_compute_(handle, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, fillFactor, dropTolerance, shift);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool IterativeSolverSolve(
+            IntPtr handle,
+            int maxIterations,
+            double tolerance,
+            ReadOnlySpan<double> rhs,
+            int size,
+            ReadOnlySpan<double> initialGuess,
+            Span<double> vout,
+            out int iterations,
+            out double error,
+            IntPtr monitor)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (double* pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                {
+                    double* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        bool result = ThunkSparseEigen.siterative_solve_(handle, maxIterations, tolerance, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, monitor);
+                        iterations = iterationsOut;
+                        error = errorOut;
+                        return result;
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void IterativeSolverDestroy(IntPtr handle)
+        {
+            ThunkSparseEigen.siterative_destroy_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr FactorizationCreate(int solverType)
+        {
+            return ThunkSparseEigen.sfactorization_create_(solverType);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationAnalyzePattern(
+            IntPtr handle,
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                    {
+                        fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                        {
+                            ThunkSparseEigen.sfactorization_analyzePattern_(handle, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool FactorizationFactorize(
+            IntPtr handle,
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                    {
+                        fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                        {
+                            return ThunkSparseEigen.sfactorization_factorize_(handle, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool FactorizationSolve(IntPtr handle, ReadOnlySpan<double> rhs, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        return ThunkSparseEigen.sfactorization_solve_(handle, pRhs, rhs.Length, pVOut, vout.Length);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool FactorizationSolveBlock(IntPtr handle, ReadOnlySpan<double> rhs, int rhsRows, int rhsCols, Span<double> vout, int rows)
+        {
+            unsafe
+            {
+                fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        return ThunkSparseEigen.sfactorization_solveBlock_(handle, pRhs, rhsRows, rhsCols, pVOut, rows);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static DirectSolverStats FactorizationStats(IntPtr handle)
+        {
+            unsafe
+            {
+                DirectSolverStats stats;
+                ThunkSparseEigen.sfactorization_stats_(handle, &stats);
+                return stats;
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void FactorizationDestroy(IntPtr handle)
+        {
+            ThunkSparseEigen.sfactorization_destroy_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveBlock(
+            int solverType,
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values,
+            ReadOnlySpan<double> rhs,
+            int rhsCols,
+            Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                    {
+                        fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                        {
+                            fixed (double* pRhs = &MemoryMarshal.GetReference(rhs))
+                            {
+                                fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                                {
+                                    return ThunkSparseEigen.ssolve_block_(solverType, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, rhsCols, pVOut);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveMixedPrecision(
+            int solverType,
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values,
+            ReadOnlySpan<double> rhs,
+            int size,
+            Span<double> vout,
+            out int steps)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            int stepsOut;
+                            bool result = ThunkSparseEigen.ssolve_mixedPrecision_(solverType, rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, &stepsOut);
+                            steps = stepsOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static IntPtr MultiplierCreate(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex))
+                {
+                    fixed (int* pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                    {
+                        fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                        {
+                            return ThunkSparseEigen.smultv_create_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MultiplierMultiply(IntPtr handle, ReadOnlySpan<double> vector, Span<double> vout)
+        {
+            unsafe
+            {
+                fixed (double* pVector = &MemoryMarshal.GetReference(vector))
+                {
+                    fixed (double* pVOut = &MemoryMarshal.GetReference(vout))
+                    {
+                        ThunkSparseEigen.smultv_multiply_(handle, pVector, pVOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void MultiplierDestroy(IntPtr handle)
+        {
+            ThunkSparseEigen.smultv_destroy_(handle);
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int Eigs(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values,
+            int k,
+            int which,
+            double sigma,
+            int subspace,
+            int maxRestarts,
+            double tolerance,
+            Span<double> realValues,
+            Span<double> imagValues,
+            Span<double> realVectors,
+            Span<double> imagVectors,
+            out bool symmetric,
+            out int restarts,
+            out int converged)
+        {
+            unsafe
+            {
+                int symmetricOut;
+                int restartsOut;
+                int convergedOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        fixed (double* pRealValues = &MemoryMarshal.GetReference(realValues), pImagValues = &MemoryMarshal.GetReference(imagValues),
+                            pRealVectors = &MemoryMarshal.GetReference(realVectors), pImagVectors = &MemoryMarshal.GetReference(imagVectors))
+                        {
+                            int info = ThunkSparseEigen.seigs_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, k, which, sigma, subspace, maxRestarts, tolerance,
+                                pRealValues, pImagValues, pRealVectors, pImagVectors, &symmetricOut, &restartsOut, &convergedOut);
+                            symmetric = symmetricOut != 0;
+                            restarts = restartsOut;
+                            converged = convergedOut;
+                            return info;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int Svds(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<double> values,
+            int k,
+            int subspace,
+            int maxRestarts,
+            double tolerance,
+            Span<double> uout,
+            Span<double> sout,
+            Span<double> vout,
+            out int restarts,
+            out int converged)
+        {
+            unsafe
+            {
+                int restartsOut;
+                int convergedOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (double* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        fixed (double* pUOut = &MemoryMarshal.GetReference(uout), pSOut = &MemoryMarshal.GetReference(sout), pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            int info = ThunkSparseEigen.ssvds_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, k, subspace, maxRestarts, tolerance,
+                                pUOut, pSOut, pVOut, &restartsOut, &convergedOut);
+                            restarts = restartsOut;
+                            converged = convergedOut;
+                            return info;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveConjugateGradient(
+            int rows,
+            int cols,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            ReadOnlySpan<float> initialGuess,
+            Span<float> vout,
+            out int iterations,
+            out double error)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                    {
+                        float* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            bool result = ThunkSparseEigen.sfsolve_conjugateGradient_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, IntPtr.Zero);
+                            iterations = iterationsOut;
+                            error = errorOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveBiCGSTAB(
+            int rows,
+            int cols,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            ReadOnlySpan<float> initialGuess,
+            Span<float> vout,
+            out int iterations,
+            out double error)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                    {
+                        float* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            bool result = ThunkSparseEigen.sfsolve_biCGSTAB_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, IntPtr.Zero);
+                            iterations = iterationsOut;
+                            error = errorOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveLeastSquaresConjugateGradient(
+            int rows,
+            int cols,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            ReadOnlySpan<float> initialGuess,
+            Span<float> vout,
+            out int iterations,
+            out double error)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                    {
+                        float* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            bool result = ThunkSparseEigen.sfsolve_LeastSquaresConjugateGradient_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, IntPtr.Zero);
+                            iterations = iterationsOut;
+                            error = errorOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveGMRES(
+            int rows,
+            int cols,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            ReadOnlySpan<float> initialGuess,
+            Span<float> vout,
+            out int iterations,
+            out double error)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                    {
+                        float* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            bool result = ThunkSparseEigen.sfsolve_GMRES_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, IntPtr.Zero);
+                            iterations = iterationsOut;
+                            error = errorOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool SolveMINRES(
+            int rows,
+            int cols,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            ReadOnlySpan<float> initialGuess,
+            Span<float> vout,
+            out int iterations,
+            out double error)
+        {
+            unsafe
+            {
+                int iterationsOut;
+                double errorOut;
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs), pInitialGuess = &MemoryMarshal.GetReference(initialGuess))
+                    {
+                        float* pGuess = initialGuess.IsEmpty ? null : pInitialGuess;
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            bool result = ThunkSparseEigen.sfsolve_MINRES_(rows, cols, nnz, maxIterations, tolerance, preconditioner, fillFactor, dropTolerance, shift, pOuterIndex, pInnerIndex, pValues, pRhs, size, pGuess, pVOut, &iterationsOut, &errorOut, IntPtr.Zero);
+                            iterations = iterationsOut;
+                            error = errorOut;
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static int FromTriplets(
+            int rows,
+            int cols,
+            int count,
+            ReadOnlySpan<int> rowIndices,
+            ReadOnlySpan<int> colIndices,
+            ReadOnlySpan<float> values,
+            Span<int> outerIndex,
+            Span<int> innerIndex,
+            Span<float> valuesOut)
+        {
+            unsafe
+            {
+                fixed (int* pRowIndices = &MemoryMarshal.GetReference(rowIndices), pColIndices = &MemoryMarshal.GetReference(colIndices),
+                    pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pValuesOut = &MemoryMarshal.GetReference(valuesOut))
+                    {
+                        return ThunkSparseEigen.sffrom_triplets_(rows, cols, count, pRowIndices, pColIndices, pValues, pOuterIndex, pInnerIndex, pValuesOut);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void ADD(
+            int rows,
+            int cols,
+            int nnz1,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<float> values1,
+            int nnz2,
+            ReadOnlySpan<int> outerIndex2,
+            ReadOnlySpan<int> innerIndex2,
+            ReadOnlySpan<float> values2,
+            ReadOnlySpan<int> outerIndex,
+            Span<int> innerIndex,
+            Span<float> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1),
+                    pOuterIndex2 = &MemoryMarshal.GetReference(outerIndex2), pInnerIndex2 = &MemoryMarshal.GetReference(innerIndex2))
+                {
+                    fixed (float* pValues1 = &MemoryMarshal.GetReference(values1), pValues2 = &MemoryMarshal.GetReference(values2))
+                    {
+                        fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                        {
+                            fixed (float* pValues = &MemoryMarshal.GetReference(values))
+                            {
+                                ThunkSparseEigen.sfadd_(rows, cols,
+                                    nnz1, pOuterIndex1, pInnerIndex1, pValues1,
+                                    nnz2, pOuterIndex2, pInnerIndex2, pValues2,
+                                    pOuterIndex, pInnerIndex, pValues);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Minus(
+            int rows,
+            int cols,
+            int nnz1,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<float> values1,
+            int nnz2,
+            ReadOnlySpan<int> outerIndex2,
+            ReadOnlySpan<int> innerIndex2,
+            ReadOnlySpan<float> values2,
+            ReadOnlySpan<int> outerIndex,
+            Span<int> innerIndex,
+            Span<float> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1),
+                    pOuterIndex2 = &MemoryMarshal.GetReference(outerIndex2), pInnerIndex2 = &MemoryMarshal.GetReference(innerIndex2))
+                {
+                    fixed (float* pValues1 = &MemoryMarshal.GetReference(values1), pValues2 = &MemoryMarshal.GetReference(values2))
+                    {
+                        fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                        {
+                            fixed (float* pValues = &MemoryMarshal.GetReference(values))
+                            {
+                                ThunkSparseEigen.sfminus_(rows, cols,
+                                    nnz1, pOuterIndex1, pInnerIndex1, pValues1,
+                                    nnz2, pOuterIndex2, pInnerIndex2, pValues2,
+                                    pOuterIndex, pInnerIndex, pValues);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Mult(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> vector,
+            int length,
+            Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pVector = &MemoryMarshal.GetReference(vector))
+                    {
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkSparseEigen.sfmultv_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pVector, length, pVOut);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void Transpose(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex1,
+            ReadOnlySpan<int> innerIndex1,
+            ReadOnlySpan<float> values1,
+            Span<int> outerIndex,
+            Span<int> innerIndex,
+            Span<float> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex1 = &MemoryMarshal.GetReference(outerIndex1), pInnerIndex1 = &MemoryMarshal.GetReference(innerIndex1))
+                {
+                    fixed (float* pValues1 = &MemoryMarshal.GetReference(values1))
+                    {
+                        fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                        {
+                            fixed (float* pValues = &MemoryMarshal.GetReference(values))
+                            {
+                                ThunkSparseEigen.sftranspose_(rows, cols,
+                                    nnz, pOuterIndex1, pInnerIndex1, pValues1,
+                                    pOuterIndex, pInnerIndex, pValues);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float Norm(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        return ThunkSparseEigen.sfnorm_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static float SquaredNorm(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values))
+                    {
+                        return ThunkSparseEigen.sfsquaredNorm_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues);
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveSimplicialLLT(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkSparseEigen.sfsolve_simplicialLLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, null);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveSimplicialLDLT(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkSparseEigen.sfsolve_simplicialLDLT_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, null);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveSparseLU(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkSparseEigen.sfsolve_sparseLU_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, null);
+                        }
+                    }
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static void SolveSparseQR(
+            int rows,
+            int cols,
+            int nnz,
+            ReadOnlySpan<int> outerIndex,
+            ReadOnlySpan<int> innerIndex,
+            ReadOnlySpan<float> values,
+            ReadOnlySpan<float> rhs,
+            int size,
+            Span<float> vout)
+        {
+            unsafe
+            {
+                fixed (int* pOuterIndex = &MemoryMarshal.GetReference(outerIndex), pInnerIndex = &MemoryMarshal.GetReference(innerIndex))
+                {
+                    fixed (float* pValues = &MemoryMarshal.GetReference(values), pRhs = &MemoryMarshal.GetReference(rhs))
+                    {
+                        fixed (float* pVOut = &MemoryMarshal.GetReference(vout))
+                        {
+                            ThunkSparseEigen.sfsolve_sparseQR_(rows, cols, nnz, pOuterIndex, pInnerIndex, pValues, pRhs, size, pVOut, null);
+                        }
+                    }
+                }
+            }
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+﻿using System;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace EigenCore.Eigen
+{
+    /// <summary>
+    /// Loads the fastest eigen_core build the host can run. The baseline library reports the
+    /// supported instruction set level (cpuid), then eigen_core_avx512 or eigen_core_avx2 is
+    /// loaded when present next to it. EIGEN_CORE_ISA=sse2|avx2|avx512 caps the level.
+    /// </summary>
+    internal static class NativeLibraryResolver
+    {
+        // indexed by InstructionSetLevel in EigenNative.cpp.
+        private static readonly string[] Variants = { "sse2", "avx2", "avx512" };
+
+        private static IntPtr _library;
+
+        [ModuleInitializer]
+        internal static void Initialize()
+        {
+            NativeLibrary.SetDllImportResolver(typeof(NativeLibraryResolver).Assembly, Resolve);
+        }
+
+        private static IntPtr Resolve(string libraryName, Assembly assembly, DllImportSearchPath? searchPath)
+        {
+            if (libraryName != ThunkSharedEigen.NativeThunkEigenPath)
+            {
+                return IntPtr.Zero;
+            }
+
+            if (_library == IntPtr.Zero)
+            {
+                _library = Load(assembly, searchPath);
+            }
+
+            return _library;
+        }
+
+        private static unsafe IntPtr Load(Assembly assembly, DllImportSearchPath? searchPath)
+        {
+            if (!NativeLibrary.TryLoad(ThunkSharedEigen.NativeThunkEigenPath, assembly, searchPath, out IntPtr baseline))
+            {
+                // let the runtime report the missing library.
+                return IntPtr.Zero;
+            }
+
+            if (!NativeLibrary.TryGetExport(baseline, "simd_supported_level_", out IntPtr supportedLevel))
+            {
+                return baseline;
+            }
+
+            int level = ((delegate* unmanaged<int>)supportedLevel)();
+            int requested = Array.IndexOf(Variants, Environment.GetEnvironmentVariable("EIGEN_CORE_ISA")?.ToLowerInvariant());
+            if (requested >= 0)
+            {
+                level = Math.Min(level, requested);
+            }
+
+            for (; level > 0; level--)
+            {
+                if (NativeLibrary.TryLoad(ThunkSharedEigen.NativeThunkEigenPath + "_" + Variants[level], assembly, searchPath, out IntPtr variant))
+                {
+                    return variant;
+                }
+            }
+
+            return baseline;
+        }
+    }
+}
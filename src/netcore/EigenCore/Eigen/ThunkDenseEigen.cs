@@ -1,4 +1,5 @@
-﻿using System.Runtime.InteropServices;
+﻿using System;
+using System.Runtime.InteropServices;
 using System.Security;
 
 namespace EigenCore.Eigen
@@ -18,6 +19,24 @@ namespace EigenCore.Eigen
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void dscale_([In] double* firstVector, double scale, int length, [Out] double* vout);
 
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dvaxpy_(double alpha, [In] double* firstVector, int length, double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dvaxpby_(double alpha, [In] double* firstVector, double beta, int length, double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dvscal_(double alpha, int length, double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dvcopy_([In] double* firstVector, int length, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern double dvdot_squared_norm_([In] double* firstVector, [In] double* secondVector, int length, [Out] double* squaredNorm);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern double dvcg_update_(double alpha, [In] double* p, [In] double* q, int length, double* x, double* r);
+
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern double dvnorm_([In] double* firstVector, int length);
 
@@ -40,6 +59,11 @@ namespace EigenCore.Eigen
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void dmult_([In] double* firstMatrix, int row1, int col1, [In] double* secondMatrix, int row2, int col2, [Out] double* vout);
 
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dgemm_([In] double* firstMatrix, int row1, int col1, int transpose1,
+            [In] double* secondMatrix, int row2, int col2, int transpose2,
+            double alpha, double beta, double* vout);
+
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern double dnorm_([In] double* firstMatrix, int row1, int col1);
 
@@ -170,6 +194,15 @@ namespace EigenCore.Eigen
             [In] double* rhs,
             [Out] double* uout);
 
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int dsvd_randomized_([In] double* firstMatrix, int row1, int col1,
+            int rank,
+            int oversampling,
+            int powerIterations,
+            [Out] double* uout,
+            [Out] double* sout,
+            [Out] double* vout);
+
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void dsolve_colPivHouseholderQr_(
             [In] double* firstMatrix,
@@ -278,5 +311,137 @@ namespace EigenCore.Eigen
                         [Out] double* q);
 
         #endregion Matrices
+
+        #region Factorizations
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dsolve_completeOrthogonalDecomposition_(
+            [In] double* firstMatrix,
+            int row1,
+            int col1,
+            [In] double* rhs,
+            [Out] double* uout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr dfactorization_create_(int solverType);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool dfactorization_compute_(IntPtr handle, [In] double* firstMatrix, int row1, int col1);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dfactorization_solve_(IntPtr handle, [In] double* rhs, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dfactorization_solveTranspose_(IntPtr handle, [In] double* rhs, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern double dfactorization_determinant_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern double dfactorization_logAbsDeterminant_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dfactorization_destroy_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dsolve_block_(
+            int solverType,
+            [In] double* firstMatrix,
+            int row1,
+            int col1,
+            [In] double* rhs,
+            int rhsCols,
+            [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool dsolve_mixedPrecision_(
+            int solverType,
+            [In] double* firstMatrix,
+            int row1,
+            int col1,
+            [In] double* rhs,
+            [Out] double* vout,
+            [Out] int* steps);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dfactorization_solveBlock_(IntPtr handle, [In] double* rhs, int rhsCols, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dfactorization_solveTransposeBlock_(IntPtr handle, [In] double* rhs, int rhsCols, [Out] double* vout);
+
+        #endregion Factorizations
+
+        #region Batches
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dbatch_mult_(int layout, int size, int count, [In] double* a, [In] double* b, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dbatch_inverse_(int layout, int size, int count, [In] double* a, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dbatch_determinant_(int layout, int size, int count, [In] double* a, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void dbatch_solve_(int layout, int size, int count, [In] double* a, [In] double* b, [Out] double* vout);
+
+        #endregion Batches
+
+        #region Single precision
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float fdot_([In] float* firstVector, [In] float* secondVector, int length);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fadd_([In] float* firstVector, [In] float* secondVector, int length, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fscale_([In] float* firstVector, float scale, int length, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float fvnorm_([In] float* firstVector, int length);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float fvsquared_norm_([In] float* firstVector, int length);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fminus_([In] float* firstMatrix, int row1, int col1, [In] float* secondMatrix, int row2, int col2, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fmult_([In] float* firstMatrix, int row1, int col1, [In] float* secondMatrix, int row2, int col2, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fmultv_([In] float* firstMatrix, int row1, int col1, [In] float* secondVector, int length, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void ftransp_([In] float* firstMatrix, int row1, int col1, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float ftrace_([In] float* firstMatrix, int row1, int col1);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float fnorm_([In] float* firstMatrix, int row1, int col1);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float fdeterminant_([In] float* firstMatrix, int row1, int col1);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void finverse_([In] float* firstMatrix, int row1, int col1, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fsolve_colPivHouseholderQr_([In] float* firstMatrix, int row1, int col1, [In] float* rhs, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fsolve_partialPivLU_([In] float* firstMatrix, int row1, int col1, [In] float* rhs, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fsolve_llt_([In] float* firstMatrix, int row1, int col1, [In] float* rhs, [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void fsolve_ldlt_([In] float* firstMatrix, int row1, int col1, [In] float* rhs, [Out] float* vout);
+
+        #endregion Single precision
     }
 }
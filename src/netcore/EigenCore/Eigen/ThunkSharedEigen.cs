@@ -0,0 +1,131 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Security;
+
+namespace EigenCore.Eigen
+{
+    internal static class ThunkSharedEigen
+    {
+        internal const string NativeThunkEigenPath = "eigen_core";
+
+        #region Threading
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void set_num_threads_(int threads);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int get_num_threads_();
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void set_thread_budget_(int threads);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int get_thread_budget_();
+
+        #endregion
+
+        #region Instruction sets
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr simd_instruction_sets_in_use_();
+
+        #endregion
+
+        #region Instrumentation
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void instrumentation_set_enabled_([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool instrumentation_enabled_();
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void instrumentation_reset_();
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe IntPtr instrumentation_snapshot_([Out] int* count);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe IntPtr instrumentation_snapshot_entry_(IntPtr handle, int index, [Out] int* sizeBucket, [Out] long* stats, [Out] long* histogram);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void instrumentation_snapshot_destroy_(IntPtr handle);
+
+        #endregion
+
+        #region Matrix Market
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr matrixmarket_read_([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe int matrixmarket_info_(IntPtr handle, [Out] int* format, [Out] int* rows, [Out] int* cols, [Out] int* nnz);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr matrixmarket_error_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe void matrixmarket_sparse_(IntPtr handle, [Out] int* outerIndex, [Out] int* innerIndex, [Out] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe void matrixmarket_dense_(IntPtr handle, [Out] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void matrixmarket_destroy_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool smatrixmarket_write_(
+            [MarshalAs(UnmanagedType.LPUTF8Str)] string path,
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool dmatrixmarket_write_([MarshalAs(UnmanagedType.LPUTF8Str)] string path, [In] double* values, int row, int col);
+
+        #endregion
+
+        #region Binary Matrix File
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr matrixfile_open_([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe int matrixfile_info_(IntPtr handle, [Out] int* kind, [Out] int* rows, [Out] int* cols, [Out] int* nnz);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr matrixfile_error_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe void matrixfile_sparse_(IntPtr handle, [Out] int** outerIndex, [Out] int** innerIndex, [Out] double** values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern unsafe double* matrixfile_dense_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void matrixfile_close_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool smatrixfile_write_(
+            [MarshalAs(UnmanagedType.LPUTF8Str)] string path,
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool dmatrixfile_write_([MarshalAs(UnmanagedType.LPUTF8Str)] string path, [In] double* values, int row, int col);
+
+        #endregion
+    }
+}
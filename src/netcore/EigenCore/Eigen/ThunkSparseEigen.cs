@@ -1,4 +1,6 @@
-﻿using System.Runtime.InteropServices;
+﻿using EigenCore.Core.Sparse.LinearAlgebra;
+using System;
+using System.Runtime.InteropServices;
 using System.Security;
 
 namespace EigenCore.Eigen
@@ -8,101 +10,167 @@ namespace EigenCore.Eigen
         internal const string NativeThunkEigenPath = "eigen_core";
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_conjugateGradient_(
             int row,
             int col,
             int nnz,
             int maxIterations,
             double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
             [In] int* outerIndex,
             [In] int* innerIndex,
             [In] double* values,
             [In] double* inrhs,
             [In] int size,
+            [In] double* x0,
             [Out] double* vout,
             [Out] int* iterations,
-            [Out] double* error);
+            [Out] double* error,
+            IntPtr monitor);
 
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+
+
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_biCGSTAB_(
              int row,
              int col,
              int nnz,
              int maxIterations,
              double tolerance,
+             int preconditioner,
+             int fillFactor,
+             double dropTolerance,
+             double shift,
              [In] int* outerIndex,
              [In] int* innerIndex,
              [In] double* values,
              [In] double* inrhs,
              [In] int size,
+             [In] double* x0,
              [Out] double* vout,
              [Out] int* iterations,
-             [Out] double* error);
+             [Out] double* error,
+             IntPtr monitor);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_LeastSquaresConjugateGradient_(
              int row,
              int col,
              int nnz,
              int maxIterations,
              double tolerance,
+             int preconditioner,
+             int fillFactor,
+             double dropTolerance,
+             double shift,
              [In] int* outerIndex,
              [In] int* innerIndex,
              [In] double* values,
              [In] double* inrhs,
              [In] int size,
+             [In] double* x0,
              [Out] double* vout,
              [Out] int* iterations,
-             [Out] double* error);
+             [Out] double* error,
+             IntPtr monitor);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_GMRES_(
               int row,
               int col,
               int nnz,
               int maxIterations,
               double tolerance,
+              int preconditioner,
+              int fillFactor,
+              double dropTolerance,
+              double shift,
               [In] int* outerIndex,
               [In] int* innerIndex,
               [In] double* values,
               [In] double* inrhs,
               [In] int size,
+              [In] double* x0,
               [Out] double* vout,
               [Out] int* iterations,
-              [Out] double* error);
+              [Out] double* error,
+              IntPtr monitor);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_MINRES_(
               int row,
               int col,
               int nnz,
               int maxIterations,
               double tolerance,
+              int preconditioner,
+              int fillFactor,
+              double dropTolerance,
+              double shift,
               [In] int* outerIndex,
               [In] int* innerIndex,
               [In] double* values,
               [In] double* inrhs,
               [In] int size,
+              [In] double* x0,
               [Out] double* vout,
               [Out] int* iterations,
-              [Out] double* error);
+              [Out] double* error,
+              IntPtr monitor);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool ssolve_DGMRES_(
               int row,
               int col,
               int nnz,
               int maxIterations,
               double tolerance,
+              int preconditioner,
+              int fillFactor,
+              double dropTolerance,
+              double shift,
               [In] int* outerIndex,
               [In] int* innerIndex,
               [In] double* values,
               [In] double* inrhs,
               [In] int size,
+              [In] double* x0,
               [Out] double* vout,
               [Out] int* iterations,
-              [Out] double* error);
+              [Out] double* error,
+              IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sfrom_triplets_(
+            int row,
+            int col,
+            int count,
+            [In] int* rowIndices,
+            [In] int* colIndices,
+            [In] double* values,
+            [Out] int* outerIndex,
+            [Out] int* innerIndex,
+            [Out] double* valuesout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sadd_symbolic_(
+            int row,
+            int col,
+            [In] int* outerIndex1,
+            [In] int* innerIndex1,
+            [In] int* outerIndex2,
+            [In] int* innerIndex2,
+            [Out] int* outerIndex);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void sadd_(
@@ -116,8 +184,7 @@ namespace EigenCore.Eigen
             [In] int* outerIndex2,
             [In] int* innerIndex2,
             [In] double* values2,
-            [Out] int* nnz,
-            [Out] int* outerIndex,
+            [In] int* outerIndex,
             [Out] int* innerIndex,
             [Out] double* values);
 
@@ -133,14 +200,25 @@ namespace EigenCore.Eigen
             [In] int* outerIndex2,
             [In] int* innerIndex2,
             [In] double* values2,
-            [Out] int* nnz,
-            [Out] int* outerIndex,
+            [In] int* outerIndex,
             [Out] int* innerIndex,
             [Out] double* values);
 
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int smult_symbolic_(
+           int row,
+           int inner,
+           int col,
+           [In] int* outerIndex1,
+           [In] int* innerIndex1,
+           [In] int* outerIndex2,
+           [In] int* innerIndex2,
+           [Out] int* outerIndex);
+
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void smult_(
            int row,
+           int inner,
            int col,
            int nnz1,
            [In] int* outerIndex1,
@@ -150,8 +228,25 @@ namespace EigenCore.Eigen
            [In] int* outerIndex2,
            [In] int* innerIndex2,
            [In] double* values2,
-           [Out] int* nnz,
-           [Out] int* outerIndex,
+           [In] int* outerIndex,
+           [Out] int* innerIndex,
+           [Out] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int smult_pruned_(
+           int row,
+           int inner,
+           int col,
+           int nnz1,
+           [In] int* outerIndex1,
+           [In] int* innerIndex1,
+           [In] double* values1,
+           int nnz2,
+           [In] int* outerIndex2,
+           [In] int* innerIndex2,
+           [In] double* values2,
+           double dropTolerance,
+           [In, Out] int* outerIndex,
            [Out] int* innerIndex,
            [Out] double* values);
 
@@ -181,7 +276,7 @@ namespace EigenCore.Eigen
            [Out] double* valuesout);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
-        public static extern void ssolve_simplicialLLT_(
+        public static extern int ssolve_simplicialLLT_(
            int row,
            int col,
            int nnz,
@@ -190,11 +285,12 @@ namespace EigenCore.Eigen
            [In] double* values,
            [In] double* inrhs,
            [In] int size,
-           [Out] double* vout);
+           [Out] double* vout,
+           [Out] DirectSolverStats* stats);
 
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
-        public static extern void ssolve_simplicialLDLT_(
+        public static extern int ssolve_simplicialLDLT_(
            int row,
            int col,
            int nnz,
@@ -203,11 +299,12 @@ namespace EigenCore.Eigen
            [In] double* values,
            [In] double* inrhs,
            [In] int size,
-           [Out] double* vout);
+           [Out] double* vout,
+           [Out] DirectSolverStats* stats);
 
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
-        public static extern void ssolve_sparseLU_(
+        public static extern int ssolve_sparseLU_(
             int row,
             int col,
             int nnz,
@@ -216,11 +313,12 @@ namespace EigenCore.Eigen
             [In] double* values,
             [In] double* inrhs,
             [In] int size,
-            [Out] double* vout);
+            [Out] double* vout,
+            [Out] DirectSolverStats* stats);
 
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
-        public static extern void ssolve_sparseQR_(
+        public static extern int ssolve_sparseQR_(
             int row,
             int col,
             int nnz,
@@ -229,7 +327,8 @@ namespace EigenCore.Eigen
             [In] double* values,
             [In] double* inrhs,
             [In] int size,
-            [Out] double* vout);
+            [Out] double* vout,
+            [Out] DirectSolverStats* stats);
 
         [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
         public static extern void snormal_equations__leastsquares_sparselu_(
@@ -283,5 +382,425 @@ namespace EigenCore.Eigen
            [In] double* values,
            [In] double* rhs,
            [In] double* x);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr siterative_create_(int solverType, int preconditioner);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool siterative_compute_(
+           IntPtr handle,
+           int row,
+           int col,
+           int nnz,
+           [In] int* outerIndex,
+           [In] int* innerIndex,
+           [In] double* values,
+           int fillFactor,
+           double dropTolerance,
+           double shift);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool siterative_solve_(
+           IntPtr handle,
+           int maxIterations,
+           double tolerance,
+           [In] double* inrhs,
+           [In] int size,
+           [In] double* x0,
+           [Out] double* vout,
+           [Out] int* iterations,
+           [Out] double* error,
+           IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void siterative_destroy_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr sfactorization_create_(int solverType);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfactorization_analyzePattern_(
+           IntPtr handle,
+           int row,
+           int col,
+           int nnz,
+           [In] int* outerIndex,
+           [In] int* innerIndex,
+           [In] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfactorization_factorize_(
+           IntPtr handle,
+           int row,
+           int col,
+           int nnz,
+           [In] int* outerIndex,
+           [In] int* innerIndex,
+           [In] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfactorization_solve_(
+           IntPtr handle,
+           [In] double* inrhs,
+           int rhsSize,
+           [Out] double* vout,
+           int size);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfactorization_solveBlock_(
+           IntPtr handle,
+           [In] double* b,
+           int rhsSize,
+           int rhsCols,
+           [Out] double* vout,
+           int size);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfactorization_stats_(IntPtr handle, [Out] DirectSolverStats* stats);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfactorization_destroy_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool ssolve_block_(
+            int solverType,
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values,
+            [In] double* b,
+            int rhsCols,
+            [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool ssolve_mixedPrecision_(
+            int solverType,
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values,
+            [In] double* inrhs,
+            int size,
+            [Out] double* vout,
+            [Out] int* steps);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern IntPtr smultv_create_(
+           int row,
+           int col,
+           int nnz,
+           [In] int* outerIndex,
+           [In] int* innerIndex,
+           [In] double* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void smultv_multiply_(IntPtr handle, [In] double* v1, [Out] double* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void smultv_destroy_(IntPtr handle);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int seigs_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values,
+            int k,
+            int which,
+            double sigma,
+            int subspace,
+            int maxRestarts,
+            double tolerance,
+            [Out] double* realValues,
+            [Out] double* imagValues,
+            [Out] double* realVectors,
+            [Out] double* imagVectors,
+            [Out] int* symmetric,
+            [Out] int* restarts,
+            [Out] int* converged);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int ssvds_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] double* values,
+            int k,
+            int subspace,
+            int maxRestarts,
+            double tolerance,
+            [Out] double* uout,
+            [Out] double* sout,
+            [Out] double* vout,
+            [Out] int* restarts,
+            [Out] int* converged);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sffrom_triplets_(
+            int row,
+            int col,
+            int count,
+            [In] int* rowIndices,
+            [In] int* colIndices,
+            [In] float* values,
+            [Out] int* outerIndex,
+            [Out] int* innerIndex,
+            [Out] float* valuesout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfadd_(
+            int row,
+            int col,
+            int nnz1,
+            [In] int* outerIndex1,
+            [In] int* innerIndex1,
+            [In] float* values1,
+            int nnz2,
+            [In] int* outerIndex2,
+            [In] int* innerIndex2,
+            [In] float* values2,
+            [In] int* outerIndex,
+            [Out] int* innerIndex,
+            [Out] float* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfminus_(
+            int row,
+            int col,
+            int nnz1,
+            [In] int* outerIndex1,
+            [In] int* innerIndex1,
+            [In] float* values1,
+            int nnz2,
+            [In] int* outerIndex2,
+            [In] int* innerIndex2,
+            [In] float* values2,
+            [In] int* outerIndex,
+            [Out] int* innerIndex,
+            [Out] float* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sfmultv_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* v1,
+            int length,
+            [Out] float* vout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern void sftranspose_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [Out] int* outerIndexout,
+            [Out] int* innerIndexout,
+            [Out] float* valuesout);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float sfnorm_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern float sfsquaredNorm_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sfsolve_simplicialLLT_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            int size,
+            [Out] float* vout,
+            [Out] DirectSolverStats* stats);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sfsolve_simplicialLDLT_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            int size,
+            [Out] float* vout,
+            [Out] DirectSolverStats* stats);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sfsolve_sparseLU_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            int size,
+            [Out] float* vout,
+            [Out] DirectSolverStats* stats);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        public static extern int sfsolve_sparseQR_(
+            int row,
+            int col,
+            int nnz,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            int size,
+            [Out] float* vout,
+            [Out] DirectSolverStats* stats);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfsolve_conjugateGradient_(
+            int row,
+            int col,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            [In] int size,
+            [In] float* x0,
+            [Out] float* vout,
+            [Out] int* iterations,
+            [Out] double* error,
+            IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfsolve_biCGSTAB_(
+            int row,
+            int col,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            [In] int size,
+            [In] float* x0,
+            [Out] float* vout,
+            [Out] int* iterations,
+            [Out] double* error,
+            IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfsolve_LeastSquaresConjugateGradient_(
+            int row,
+            int col,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            [In] int size,
+            [In] float* x0,
+            [Out] float* vout,
+            [Out] int* iterations,
+            [Out] double* error,
+            IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfsolve_GMRES_(
+            int row,
+            int col,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            [In] int size,
+            [In] float* x0,
+            [Out] float* vout,
+            [Out] int* iterations,
+            [Out] double* error,
+            IntPtr monitor);
+
+        [DllImport(NativeThunkEigenPath), SuppressUnmanagedCodeSecurity]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool sfsolve_MINRES_(
+            int row,
+            int col,
+            int nnz,
+            int maxIterations,
+            double tolerance,
+            int preconditioner,
+            int fillFactor,
+            double dropTolerance,
+            double shift,
+            [In] int* outerIndex,
+            [In] int* innerIndex,
+            [In] float* values,
+            [In] float* inrhs,
+            [In] int size,
+            [In] float* x0,
+            [Out] float* vout,
+            [Out] int* iterations,
+            [Out] double* error,
+            IntPtr monitor);
     }
 }
\ No newline at end of file
@@ -0,0 +1,25 @@
+//------------------------------------------------------------------------------
+// <auto-generated>
+//     This code was generated by a tool.
+//
+//     Changes to this file may cause incorrect behavior and will be lost if
+//     the code is regenerated.
+// </auto-generated>
+//------------------------------------------------------------------------------
+
+using System;
+using System.Reflection;
+
+[assembly: System.Reflection.AssemblyCompanyAttribute("modios")]
+[assembly: System.Reflection.AssemblyConfigurationAttribute("Release")]
+[assembly: System.Reflection.AssemblyCopyrightAttribute("modios")]
+[assembly: System.Reflection.AssemblyDescriptionAttribute(".Net wrapper for the Eigen C++ library")]
+[assembly: System.Reflection.AssemblyFileVersionAttribute("1.0.0.0")]
+[assembly: System.Reflection.AssemblyInformationalVersionAttribute("1.0.0-alpha+a6907796e365289a40d4c1d36393035d5dc5b316")]
+[assembly: System.Reflection.AssemblyProductAttribute("EigenCore")]
+[assembly: System.Reflection.AssemblyTitleAttribute("EigenCore")]
+[assembly: System.Reflection.AssemblyVersionAttribute("1.0.0.0")]
+[assembly: System.Reflection.AssemblyMetadataAttribute("RepositoryUrl", "https://github.com/modios/EigenCore")]
+
+// Generated by the MSBuild WriteCodeFragment class.
+
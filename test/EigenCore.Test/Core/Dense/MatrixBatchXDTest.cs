@@ -0,0 +1,75 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.LinearAlgebra;
+using System.Linq;
+using Xunit;
+
+namespace EigenCore.Test.Core.Dense
+{
+    public class MatrixBatchXDTest
+    {
+        public const int DoublePrecision = 12;
+
+        private static void AssertEqual(MatrixXD expected, MatrixXD actual)
+        {
+            double[] expectedValues = expected.GetValues().ToArray();
+            double[] actualValues = actual.GetValues().ToArray();
+            Assert.Equal(expectedValues.Length, actualValues.Length);
+            for (int i = 0; i < expectedValues.Length; i++)
+            {
+                Assert.Equal(expectedValues[i], actualValues[i], DoublePrecision);
+            }
+        }
+
+        [Theory]
+        [InlineData(3, BatchLayout.Contiguous)]
+        [InlineData(3, BatchLayout.Interleaved)]
+        [InlineData(6, BatchLayout.Contiguous)]
+        [InlineData(6, BatchLayout.Interleaved)]
+        [InlineData(7, BatchLayout.Interleaved)]
+        public void Batch_ShouldSucceed(int size, BatchLayout layout)
+        {
+            // diagonally dominant, with a permutation so that the solves need pivoting.
+            MatrixXD[] matrices = Enumerable.Range(0, 37)
+                .Select(n => MatrixXD.Random(size, size, -1, 1).Plus(MatrixXD.Diag(Enumerable.Repeat(size + n % 3.0, size).ToArray())))
+                .ToArray();
+            double[,] swap = new double[size, size];
+            for (int i = 2; i < size; i++)
+            {
+                swap[i, i] = 1;
+            }
+
+            swap[0, 1] = swap[1, 0] = 1;
+            matrices[1] = new MatrixXD(swap).Mult(matrices[1]);
+
+            MatrixBatchXD batch = new MatrixBatchXD(matrices).ToLayout(layout);
+            Assert.Equal(layout, batch.Layout);
+            AssertEqual(matrices[5], batch.Get(5));
+
+            MatrixBatchXD product = batch.Mult(batch);
+            MatrixBatchXD inverse = batch.Inverse();
+            VectorXD determinant = batch.Determinant();
+            for (int n = 0; n < matrices.Length; n++)
+            {
+                AssertEqual(matrices[n].Mult(matrices[n]), product.Get(n));
+                AssertEqual(matrices[n].Inverse(), inverse.Get(n));
+                Assert.Equal(1.0, determinant.GetItem(n) / matrices[n].Determinant(), DoublePrecision);
+            }
+
+            MatrixXD rhs = MatrixXD.Ones(size, matrices.Length);
+            MatrixXD x = batch.Solve(layout == BatchLayout.Contiguous ? rhs : rhs.Transpose());
+            if (layout == BatchLayout.Interleaved)
+            {
+                x = x.Transpose();
+            }
+
+            for (int n = 0; n < matrices.Length; n++)
+            {
+                VectorXD expected = matrices[n].Solve(VectorXD.Ones(size), DenseSolverType.PartialPivLU);
+                for (int i = 0; i < size; i++)
+                {
+                    Assert.Equal(expected.GetItem(i), x.Col(n).GetItem(i), DoublePrecision);
+                }
+            }
+        }
+    }
+}
@@ -1,6 +1,8 @@
 ﻿using EigenCore.Core.Dense;
 using EigenCore.Core.Dense.LinearAlgebra;
 using EigenCore.Core.Shared;
+using System;
+using System.Linq;
 using Xunit;
 
 namespace EigenCore.Test.Core.Dense
@@ -56,6 +58,39 @@ namespace EigenCore.Test.Core.Dense
             Assert.Equal(new double[] { 11, 35, 0, 20 }, result.GetValues().ToArray());
         }
 
+        [Fact]
+        public void MultAdd_ShouldSucceed()
+        {
+            MatrixXD A = new MatrixXD("1 2 3; 4 5 6");
+            MatrixXD B = new MatrixXD("1 0; 2 1; 0 3");
+
+            // 2 A B + 3 C with A B = [5 11; 14 23].
+            MatrixXD C = new MatrixXD("1 1; 1 1");
+            C.MultAdd(A, B, 2, 3);
+            Assert.Equal(new MatrixXD("13 25; 31 49"), C);
+
+            // beta = 0 ignores what C holds.
+            C = new MatrixXD("1 1; 1 1");
+            C.Scale(double.NaN);
+            C.MultAdd(A, B.Transpose(), beta: 0, transposeB: true);
+            Assert.Equal(new MatrixXD("5 11; 14 23"), C);
+
+            MatrixXD D = MatrixXD.Zeros(3, 3);
+            D.MultAdd(A, A, transposeA: true);
+            Assert.Equal(A.TMult(), D);
+
+            D = MatrixXD.Zeros(3, 3);
+            D.MultAdd(A, B, transposeA: true, transposeB: true);
+            Assert.Equal(A.Transpose().Mult(B.Transpose()), D);
+
+            // C as an operand.
+            MatrixXD S = new MatrixXD("1 2; 3 4");
+            S.MultAdd(S, S);
+            Assert.Equal(new MatrixXD("8 12; 18 26"), S);
+
+            Assert.Throws<ArgumentException>(() => C.MultAdd(A, A));
+        }
+
         [Fact]
         public void Transpose_ShouldSucceed()
         {
@@ -538,6 +573,31 @@ namespace EigenCore.Test.Core.Dense
             Assert.Equal(new VectorXD("0.46347421844577846 0.04209165616389611"), result);
         }
 
+        [Fact]
+        public void RandomizedSVD_ShouldSucceed()
+        {
+            // rank 20, wide enough that BdcSvd runs divide and conquer instead of its Jacobi fallback.
+            MatrixXD A = MatrixXD.Random(300, 20, -1, 1).Mult(MatrixXD.Random(20, 120, -1, 1));
+            double[] jacobi = A.SVD(SVDType.Jacobi).S.GetValues().ToArray();
+            double[] bdc = A.SVD(SVDType.BdcSvd).S.GetValues().ToArray();
+            for (int i = 0; i < jacobi.Length; i++)
+            {
+                Assert.True(Math.Abs(jacobi[i] - bdc[i]) <= 1e-10 * jacobi[0]);
+            }
+
+            SVDResult result = A.RandomizedSVD(10);
+            double[] s = result.S.GetValues().ToArray();
+            Assert.Equal(10, s.Length);
+            for (int i = 0; i < s.Length; i++)
+            {
+                Assert.True(Math.Abs(s[i] - jacobi[i]) <= 1e-10 * jacobi[0]);
+            }
+
+            Assert.True(A.Mult(result.V).Minus(result.U.Mult(MatrixXD.Diag(s))).Norm() <= 1e-9 * s[0]);
+            Assert.True(result.U.Transpose().Mult(result.U).Minus(MatrixXD.Identity(10)).Norm() <= 1e-12);
+            Assert.Throws<ArgumentOutOfRangeException>(() => A.RandomizedSVD(121));
+        }
+
         [Fact]
         public void LeastSquaresNE_ShouldSucceed()
         {
@@ -592,6 +652,92 @@ namespace EigenCore.Test.Core.Dense
             Assert.Equal(new VectorXD("2.3333333333333321 -1.6666666666666643 3.9999999999999978"), result);
         }
 
+        [Fact]
+        public void SolveCompleteOrthogonalDecomposition_ShouldSucceed()
+        {
+            var A = new MatrixXD("1 2 3; 4 5 6; 7 8 10");
+            var rhs = new VectorXD("3 3 4");
+            VectorXD result = A.Solve(rhs, DenseSolverType.CompleteOrthogonalDecomposition);
+            Assert.Equal(new VectorXD("-2 1 1"), result);
+        }
+
+        [InlineData(DenseSolverType.MixedPrecisionPartialPivLU)]
+        [InlineData(DenseSolverType.MixedPrecisionLLT)]
+        [Theory]
+        public void SolveMixedPrecision_ShouldSucceed(DenseSolverType denseSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8");
+            var rhs = new VectorXD("3 3 4");
+            var expected = new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558");
+            var result = A.SolveMixedPrecision(rhs, denseSolverType);
+            Assert.True(result.Converged);
+            Assert.InRange(result.RefinementSteps, 1, 5);
+            Assert.Equal(expected, result.Result);
+            Assert.Equal(expected, A.Solve(rhs, denseSolverType));
+
+            // the Hilbert matrix is too ill-conditioned for single precision factors.
+            var H = new MatrixXD(Enumerable.Range(0, 8).Select(i => Enumerable.Range(0, 8).Select(j => 1.0 / (i + j + 1)).ToArray()).ToArray());
+            var hilbertResult = H.SolveMixedPrecision(VectorXD.Ones(8), denseSolverType);
+            Assert.False(hilbertResult.Converged);
+            Assert.Equal(H.Solve(VectorXD.Ones(8), denseSolverType == DenseSolverType.MixedPrecisionLLT ? DenseSolverType.LLT : DenseSolverType.PartialPivLU),
+                hilbertResult.Result);
+        }
+
+        [InlineData(DenseSolverType.ColPivHouseholderQR)]
+        [InlineData(DenseSolverType.LLT)]
+        [InlineData(DenseSolverType.LDLT)]
+        [InlineData(DenseSolverType.PartialPivLU)]
+        [InlineData(DenseSolverType.FullPivLU)]
+        [InlineData(DenseSolverType.CompleteOrthogonalDecomposition)]
+        [Theory]
+        public void SolveBlock_ShouldSucceed(DenseSolverType denseSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8");
+            var rhs = new MatrixXD("3 1; 3 0; 4 -0.5");
+            MatrixXD result = A.Solve(rhs, denseSolverType);
+            Assert.Equal(new MatrixXD("0.22413793103448287 0.5; 0.41379310344827569 -0.5; 0.44827586206896558 0"), result);
+        }
+
+        [InlineData(DenseSolverType.ColPivHouseholderQR)]
+        [InlineData(DenseSolverType.PartialPivLU)]
+        [InlineData(DenseSolverType.FullPivLU)]
+        [InlineData(DenseSolverType.CompleteOrthogonalDecomposition)]
+        [Theory]
+        public void Factorize_ShouldSucceed(DenseSolverType denseSolverType)
+        {
+            var A = new MatrixXD("1 2 3; 4 5 6; 7 8 10");
+            using var factorization = A.Factorize(denseSolverType);
+            Assert.True(factorization.Success);
+            Assert.Equal(new VectorXD("-2 1 1"), factorization.Solve(new VectorXD("3 3 4")));
+            Assert.Equal(new VectorXD("1 1 1"), factorization.SolveTranspose(new VectorXD("12 15 19")));
+            Assert.Equal(new MatrixXD("-2 1; 1 1; 1 1"), factorization.Solve(new MatrixXD("3 6; 3 15; 4 25")));
+            Assert.Equal(new MatrixXD("1 -2; 1 1; 1 1"), factorization.SolveTranspose(new MatrixXD("12 9; 15 9; 19 10")));
+            Assert.Equal(-3, factorization.Determinant(), DoublePrecision);
+            Assert.Equal(System.Math.Log(3), factorization.LogAbsDeterminant(), DoublePrecision);
+        }
+
+        [InlineData(DenseSolverType.LLT)]
+        [InlineData(DenseSolverType.LDLT)]
+        [Theory]
+        public void Factorize_SelfAdjoint_ShouldSucceed(DenseSolverType denseSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8");
+            using var factorization = A.Factorize(denseSolverType);
+            Assert.True(factorization.Success);
+            Assert.Equal(new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558"), factorization.Solve(new VectorXD("3 3 4")));
+            Assert.Equal(new VectorXD("1 1 1"), factorization.SolveTranspose(new VectorXD("10 9 9")));
+            Assert.Equal(58, factorization.Determinant(), DoublePrecision);
+            Assert.Equal(System.Math.Log(58), factorization.LogAbsDeterminant(), DoublePrecision);
+        }
+
+        [Fact]
+        public void Factorize_NotPositiveDefinite_ShouldFail()
+        {
+            var A = new MatrixXD("1 2; 2 1");
+            using var factorization = A.Factorize(DenseSolverType.LLT);
+            Assert.False(factorization.Success);
+        }
+
         [Fact]
         public void Determinant_ShouldSucceed()
         {
@@ -0,0 +1,52 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.LinearAlgebra;
+using System;
+using Xunit;
+
+namespace EigenCore.Test.Core.Dense
+{
+    public class MatrixXFTest
+    {
+        public const int FloatPrecision = 5;
+
+        [Fact]
+        public void MatrixOperations_ShouldSucceed()
+        {
+            var A = new MatrixXF("1 2;3 4");
+            var B = new MatrixXF("5 6;7 8");
+            Assert.Equal(new MatrixXF("19 22;43 50"), A.Mult(B));
+            Assert.Equal(new VectorXF("5 11"), A.Mult(new VectorXF("1 2")));
+            Assert.Equal(new MatrixXF("6 8;10 12"), A.Plus(B));
+            Assert.Equal(new MatrixXF("-4 -4;-4 -4"), A.Minus(B));
+            Assert.Equal(new MatrixXF("1 3;2 4"), A.Transpose());
+            Assert.Equal(5, A.Trace(), FloatPrecision);
+            Assert.Equal(-2, A.Determinant(), FloatPrecision);
+            Assert.Equal(new MatrixXF("-2 1;1.5 -0.5"), A.Inverse());
+            Assert.Equal(Math.Sqrt(30), A.Norm(), FloatPrecision);
+        }
+
+        [InlineData(DenseSolverType.ColPivHouseholderQR)]
+        [InlineData(DenseSolverType.PartialPivLU)]
+        [InlineData(DenseSolverType.LLT)]
+        [InlineData(DenseSolverType.LDLT)]
+        [Theory]
+        public void Solve_ShouldSucceed(DenseSolverType denseSolverType)
+        {
+            var A = new MatrixXF("6 4 0;4 4 1;0 1 8");
+            var x = A.Solve(new VectorXF("10 9 9"), denseSolverType);
+            Assert.Equal(new VectorXF("1 1 1"), x);
+            Assert.Throws<NotSupportedException>(() => A.Solve(new VectorXF("10 9 9"), DenseSolverType.FullPivLU));
+        }
+
+        [Fact]
+        public void Conversion_ShouldSucceed()
+        {
+            var A = new MatrixXD("1 2;3 4.5");
+            var F = new MatrixXF(A);
+            Assert.Equal(2, F.Rows);
+            Assert.Equal(2, F.Cols);
+            Assert.Equal(4.5f, F.Get(1, 1));
+            Assert.Equal(A, F.ToDouble());
+        }
+    }
+}
@@ -1,4 +1,5 @@
 ﻿using EigenCore.Core.Dense;
+using System;
 using System.Linq;
 using Xunit;
 
@@ -144,5 +145,51 @@ namespace EigenCore.Test.Core.Dense.Core
             var scaledVector = A.Scale(2.0);
             Assert.Equal(new VectorXD(new double[] { 2, 4, 6, 8 }), scaledVector);
         }
+
+        [Fact]
+        public void AddInplace_ShouldSucceed()
+        {
+            var A = new VectorXD("1 2 3 4");
+            var B = new VectorXD("1 1 2 2");
+
+            A.AddInplace(B, 2.0);
+            Assert.Equal(new VectorXD("3 4 7 8"), A);
+
+            A.AddInplace(B, 1.0, 0.5);
+            Assert.Equal(new VectorXD("2.5 3 5.5 6"), A);
+
+            A.MinusInplace(B);
+            Assert.Equal(new VectorXD("1.5 2 3.5 4"), A);
+
+            A.CopyFrom(B);
+            Assert.Equal(B, A);
+
+            Assert.Throws<ArgumentException>(() => A.AddInplace(new VectorXD("1 2")));
+        }
+
+        [Fact]
+        public void DotSquaredNorm_ShouldSucceed()
+        {
+            // longer than a native block, so the blocks are summed.
+            var A = VectorXD.Linespace(1, 1500, 1500);
+            var B = VectorXD.Ones(1500);
+            var (dot, squaredNorm) = A.DotSquaredNorm(B);
+            Assert.Equal(1500.0 * 1501 / 2, dot);
+            Assert.Equal(1500.0 * 1501 * 3001 / 6, squaredNorm);
+        }
+
+        [Fact]
+        public void ConjugateGradientUpdate_ShouldSucceed()
+        {
+            var x = VectorXD.Ones(1500);
+            var r = VectorXD.Linespace(1, 1500, 1500);
+            var p = VectorXD.Linespace(1, 1500, 1500);
+            var q = VectorXD.Linespace(1, 1500, 1500);
+
+            double squaredNorm = VectorXD.ConjugateGradientUpdate(x, r, 0.5, p, q);
+            Assert.Equal(p.Scale(0.5).Add(VectorXD.Ones(1500)), x);
+            Assert.Equal(q.Scale(0.5), r);
+            Assert.Equal(0.25 * 1500.0 * 1501 * 3001 / 6, squaredNorm);
+        }
     }
 }
@@ -0,0 +1,33 @@
+﻿using EigenCore.Core.Dense;
+using System.Linq;
+using Xunit;
+
+namespace EigenCore.Test.Core.Dense
+{
+    public class VectorXFTest
+    {
+        public const int FloatPrecision = 5;
+
+        [Fact]
+        public void ArrayConstructor_ShouldSucceed()
+        {
+            VectorXF v = new VectorXF(new float[] { 1, 2, 5, 6 });
+            Assert.Equal(new float[] { 1, 2, 5, 6 }, v.GetValues().ToArray());
+            Assert.Equal(new VectorXF("1 2 5 6"), v);
+            Assert.Equal(new VectorXF(new VectorXD("1 2 5 6")), v);
+            Assert.Equal(new VectorXD("1 2 5 6"), v.ToDouble());
+        }
+
+        [Fact]
+        public void VectorOperations_ShouldSucceed()
+        {
+            var v1 = new VectorXF("1 2 3");
+            var v2 = new VectorXF("4 5 6");
+            Assert.Equal(32, v1.Dot(v2), FloatPrecision);
+            Assert.Equal(14, v1.SquaredNorm(), FloatPrecision);
+            Assert.Equal(3.7416573f, v1.Norm(), FloatPrecision);
+            Assert.Equal(new VectorXF("5 7 9"), v1.Add(v2));
+            Assert.Equal(new VectorXF("2 4 6"), v1.Scale(2));
+        }
+    }
+}
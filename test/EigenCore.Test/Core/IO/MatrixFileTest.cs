@@ -0,0 +1,104 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.LinearAlgebra;
+using EigenCore.Core.IO;
+using EigenCore.Core.Sparse;
+using EigenCore.Core.Sparse.LinearAlgebra;
+using System;
+using System.IO;
+using Xunit;
+
+namespace EigenCore.Test.Core.IO
+{
+    public class MatrixFileTest
+    {
+        private static void WithTempFile(Action<string> action)
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                action(path);
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void OpenSparse_ShouldMapSameMatrix()
+        {
+            SparseMatrixD A = new SparseMatrixD(new[] {
+                (0, 0, 4.0), (1, 0, -1.0), (0, 1, -1.0), (1, 1, 4.0),
+                (2, 1, -1.0), (1, 2, -1.0), (2, 2, 4.0)
+            }, 3, 3);
+            var b = new VectorXD("1 2 3");
+
+            WithTempFile(path =>
+            {
+                MatrixFile.Write(path, A);
+                using (MappedSparseMatrixD mapped = MatrixFile.OpenSparse(path))
+                {
+                    Assert.Equal(3, mapped.Rows);
+                    Assert.Equal(3, mapped.Cols);
+                    Assert.Equal(7, mapped.Nnz);
+                    Assert.Equal(A, mapped.ToSparseMatrixD());
+                    Assert.Equal(A.Mult(b), mapped.Mult(b));
+                    Assert.Equal(A.DirectSolve(b, DirectSolverType.SimplicialLLT), mapped.DirectSolve(b, DirectSolverType.SimplicialLLT));
+                    Assert.Equal(A.IterativeSolve(b).Result, mapped.IterativeSolve(b).Result);
+                }
+            });
+        }
+
+        [Fact]
+        public void OpenDense_ShouldMapSameMatrix()
+        {
+            MatrixXD A = new MatrixXD("4 -1 0;-1 4 -1;0 -1 4;1 1 1");
+            var x = new VectorXD("1 2 3");
+
+            WithTempFile(path =>
+            {
+                MatrixFile.Write(path, A);
+                using (MappedMatrixXD mapped = MatrixFile.OpenDense(path))
+                {
+                    Assert.Equal(4, mapped.Rows);
+                    Assert.Equal(3, mapped.Cols);
+                    Assert.Equal(A, mapped.ToMatrixXD());
+                    Assert.Equal(A.Mult(x), mapped.Mult(x));
+                    Assert.Equal(A.Solve(A.Mult(x), DenseSolverType.ColPivHouseholderQR), mapped.Solve(A.Mult(x), DenseSolverType.ColPivHouseholderQR));
+                }
+            });
+        }
+
+        [Fact]
+        public void OpenInvalidFile_ShouldThrow()
+        {
+            Assert.Throws<IOException>(() => MatrixFile.OpenSparse(Path.Combine(Path.GetTempPath(), Guid.NewGuid() + ".bin")));
+
+            WithTempFile(path =>
+            {
+                File.WriteAllText(path, "%%MatrixMarket matrix coordinate real general\n1 1 1\n1 1 1\n");
+                Assert.Throws<InvalidDataException>(() => MatrixFile.OpenSparse(path));
+
+                MatrixFile.Write(path, new MatrixXD("1 2;3 4"));
+                Assert.Throws<InvalidDataException>(() => MatrixFile.OpenSparse(path));
+
+                byte[] truncated = File.ReadAllBytes(path);
+                Array.Resize(ref truncated, truncated.Length - 8);
+                File.WriteAllBytes(path, truncated);
+                Assert.Throws<InvalidDataException>(() => MatrixFile.OpenDense(path));
+            });
+        }
+
+        [Fact]
+        public void DisposedView_ShouldThrow()
+        {
+            WithTempFile(path =>
+            {
+                MatrixFile.Write(path, SparseMatrixD.Identity(3));
+                MappedSparseMatrixD mapped = MatrixFile.OpenSparse(path);
+                mapped.Dispose();
+                Assert.Throws<ObjectDisposedException>(() => mapped.Mult(new VectorXD("1 1 1")));
+            });
+        }
+    }
+}
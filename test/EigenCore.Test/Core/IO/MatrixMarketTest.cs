@@ -0,0 +1,161 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.IO;
+using EigenCore.Core.Shared;
+using EigenCore.Core.Sparse;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+using Xunit;
+
+namespace EigenCore.Test.Core.IO
+{
+    public class MatrixMarketTest
+    {
+        private static void WithTempFile(Action<string> action, string contents = null)
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                if (contents != null)
+                {
+                    File.WriteAllText(path, contents);
+                }
+
+                action(path);
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void WriteSparse_ShouldRoundTrip()
+        {
+            (int, int, double)[] elements = {
+                (0, 1, 0.1),
+                (2, 0, 1.0 / 3.0),
+                (1, 2, -2.5e-300),
+                (3, 2, 123456789.125)
+            };
+
+            SparseMatrixD A = new SparseMatrixD(elements, 4, 3);
+            WithTempFile(path =>
+            {
+                MatrixMarket.Write(path, A);
+                SparseMatrixD result = MatrixMarket.ReadSparse(path);
+
+                Assert.Equal(4, result.Rows);
+                Assert.Equal(3, result.Cols);
+                Assert.Equal(A.GetOuterStarts().ToArray(), result.GetOuterStarts().ToArray());
+                Assert.Equal(A.GetInnerIndices().ToArray(), result.GetInnerIndices().ToArray());
+                Assert.Equal(A.GetValues().ToArray(), result.GetValues().ToArray());
+            });
+        }
+
+        [Fact]
+        public void WriteDense_ShouldRoundTrip()
+        {
+            MatrixXD A = new MatrixXD("0.1 2 -3;4.75 1e-20 6");
+            WithTempFile(path =>
+            {
+                MatrixMarket.Write(path, A);
+                MatrixXD result = MatrixMarket.ReadDense(path);
+
+                Assert.Equal(2, result.Rows);
+                Assert.Equal(3, result.Cols);
+                Assert.Equal(A.GetValues().ToArray(), result.GetValues().ToArray());
+            });
+        }
+
+        [Fact]
+        public void ReadSymmetricCoordinate_ShouldSucceed()
+        {
+            string contents = "%%MatrixMarket matrix coordinate real symmetric\r\n" +
+                "% comment\r\n" +
+                "\r\n" +
+                "3 3 4\r\n" +
+                "1 1 6\r\n" +
+                "2 1 4\r\n" +
+                "2 2 4\r\n" +
+                "3 2 1e0\r\n";
+
+            WithTempFile(path =>
+            {
+                Assert.Equal(new MatrixXD("6 4 0;4 4 1;0 1 0"), MatrixMarket.ReadSparse(path).ToDense());
+            }, contents);
+        }
+
+        [Fact]
+        public void ReadPatternAndSkewSymmetricArray_ShouldSucceed()
+        {
+            string pattern = "%%MatrixMarket matrix coordinate pattern general\n2 3 2\n1 3\n2 1\n";
+            WithTempFile(path =>
+            {
+                Assert.Equal(new MatrixXD("0 0 1;1 0 0"), MatrixMarket.ReadDense(path));
+            }, pattern);
+
+            string skew = "%%MatrixMarket matrix array integer skew-symmetric\n3 3\n2\n3\n5\n";
+            WithTempFile(path =>
+            {
+                Assert.Equal(new MatrixXD("0 -2 -3;2 0 -5;3 5 0"), MatrixMarket.ReadDense(path));
+            }, skew);
+        }
+
+        [Fact]
+        public void ReadLargeFile_ShouldMatchTriplets()
+        {
+            const int size = 20000;
+            var elements = new List<(int, int, double)>();
+            var contents = new StringBuilder();
+            for (int i = 0; i < size; i++)
+            {
+                elements.Add((i, i, 2.0 + i));
+                elements.Add(((i * 17 + 3) % size, i, -0.25 * (i % 7)));
+                elements.Add((i, (i * 31 + 11) % size, 1.0 / (i + 1)));
+            }
+
+            contents.Append("%%MatrixMarket matrix coordinate real general\n");
+            contents.Append($"{size} {size} {elements.Count}\n");
+            foreach (var (row, col, value) in elements)
+            {
+                contents.Append($"{row + 1} {col + 1} {value:R}\n");
+            }
+
+            var expected = new SparseMatrixD(elements, size, size);
+            WithTempFile(path =>
+            {
+                using (EigenThreads.Budget(4))
+                {
+                    SparseMatrixD result = MatrixMarket.ReadSparse(path);
+                    Assert.Equal(expected.GetOuterStarts().ToArray(), result.GetOuterStarts().ToArray());
+                    Assert.Equal(expected.GetInnerIndices().ToArray(), result.GetInnerIndices().ToArray());
+                    Assert.Equal(expected.GetValues().ToArray(), result.GetValues().ToArray());
+                }
+            }, contents.ToString());
+        }
+
+        [Fact]
+        public void ReadInvalidFile_ShouldThrow()
+        {
+            Assert.Throws<IOException>(() => MatrixMarket.ReadSparse(Path.Combine(Path.GetTempPath(), Guid.NewGuid() + ".mtx")));
+
+            WithTempFile(path =>
+            {
+                Assert.Throws<InvalidDataException>(() => MatrixMarket.ReadSparse(path));
+            }, "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n3 1 1\n");
+
+            WithTempFile(path =>
+            {
+                Assert.Throws<InvalidDataException>(() => MatrixMarket.ReadSparse(path));
+            }, "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1\n2 1 1\n");
+
+            WithTempFile(path =>
+            {
+                Assert.Throws<InvalidDataException>(() => MatrixMarket.ReadDense(path));
+            }, "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n");
+        }
+    }
+}
@@ -0,0 +1,14 @@
+﻿using EigenCore.Core.Shared;
+using Xunit;
+
+namespace EigenCore.Test.Core.Shared
+{
+    public class EigenSimdTest
+    {
+        [Fact]
+        public void InstructionSetsInUse_ShouldSucceed()
+        {
+            Assert.Contains("SSE2", EigenSimd.InstructionSetsInUse);
+        }
+    }
+}
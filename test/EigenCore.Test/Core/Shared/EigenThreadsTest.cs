@@ -0,0 +1,26 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Shared;
+using System.Linq;
+using Xunit;
+
+namespace EigenCore.Test.Core.Shared
+{
+    public class EigenThreadsTest
+    {
+        [Fact]
+        public void Budget_ShouldSucceed()
+        {
+            int threads = EigenThreads.NumThreads;
+            Assert.True(threads >= 1);
+
+            using (EigenThreads.Budget(1))
+            {
+                Assert.Equal(1, EigenThreads.NumThreads);
+                MatrixXD A = new MatrixXD("1 2; 3 4");
+                Assert.Equal(new double[] { 7, 15, 10, 22 }, A.Mult(A).GetValues().ToArray());
+            }
+
+            Assert.Equal(threads, EigenThreads.NumThreads);
+        }
+    }
+}
@@ -1,7 +1,10 @@
 ﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Dense.LinearAlgebra;
 using EigenCore.Core.Shared;
 using EigenCore.Core.Sparse;
 using EigenCore.Core.Sparse.LinearAlgebra;
+using System;
+using System.Collections.Generic;
 using Xunit;
 
 namespace EigenCore.Test.Core.Sparse
@@ -32,6 +35,27 @@ namespace EigenCore.Test.Core.Sparse
             }
         }
 
+        [Fact]
+        public void ConstructorListTuplesWithDuplicates_ShouldSumThem()
+        {
+            (int, int, double)[] elements = {
+                (2, 1, 5),
+                (0, 1, 3.0),
+                (2, 1, -1.5),
+                (1, 0, 22),
+                (0, 1, 1.0),
+                (1, 2, 0.0)
+            };
+
+            SparseMatrixD A = new SparseMatrixD(elements, 3, 3);
+
+            Assert.Equal(4, A.Nnz);
+            Assert.Equal(new[] { 0, 1, 3, 4 }, A.GetOuterStarts().ToArray());
+            Assert.Equal(new[] { 1, 0, 2, 1 }, A.GetInnerIndices().ToArray());
+            Assert.Equal(new MatrixXD("0 4 0;22 0 0;0 3.5 0"), A.ToDense());
+            Assert.Throws<ArgumentOutOfRangeException>(() => new SparseMatrixD(new[] { (3, 0, 1.0) }, 3, 3));
+        }
+
         [InlineData("1 2 3; 4 5 6; 7 8 2", new double[] { 1, 2, 3 }, "1 2 3;4 5 6;7 8 2;1 0 0; 0 2 0; 0 0 3")]
         [InlineData("1 2; 4 5; 7 8", new double[] { 1, 2 }, "1 2 ;4 5 ;7 8; 1 0; 0 2")]
         [InlineData("1 2; 4 5", new double[] { 1, 2 }, "1 2;4 5;1 0; 0 2")]
@@ -225,6 +249,11 @@ namespace EigenCore.Test.Core.Sparse
 
             result = A.Minus(A);
             Assert.Equal(MatrixXD.Zeros(3,3), result.ToDense());
+
+            var B = new MatrixXD("0 0 2;0 0 0;1 0 0").ToSparse();
+            result = B.Minus(SparseMatrixD.Identity(3));
+            Assert.Equal(5, result.Nnz);
+            Assert.Equal(new MatrixXD("-1 0 2;0 -1 0;1 0 -1"), result.ToDense());
         }
 
         [Fact]
@@ -247,9 +276,51 @@ namespace EigenCore.Test.Core.Sparse
 
 
             SparseMatrixD B = new MatrixXD("0 0 0;1.4 0 0;0 1.9 0;0 0 0").ToSparse();
-            SparseMatrixD C = new MatrixXD("3 0 0;0 1.2 0;0 3.2 0;0 0 0").ToSparse();
+            SparseMatrixD C = new MatrixXD("3 0 0;0 1.2 0;0 3.2 0").ToSparse();
             result = B.Mult(C);
             Assert.Equal(new MatrixXD("0 0 0;4.199999999999999 0 0;0 2.28 0;0 0 0"), result.ToDense());
+
+            SparseMatrixD D = new MatrixXD("1 0 2 0;0 0 3 0;0 0 0 0").ToSparse();
+            result = B.Mult(D);
+            Assert.Equal(3, result.Nnz);
+            Assert.Equal(new MatrixXD("0 0 0 0;1.4 0 2.8 0;0 0 5.7 0;0 0 0 0"), result.ToDense());
+            Assert.Throws<ArgumentException>(() => B.Mult(B));
+        }
+
+        [Fact]
+        public void MultWithDropTolerance_ShouldSucced()
+        {
+            SparseMatrixD A = new MatrixXD("1 0.001 0;0 1 0;0.002 0 3").ToSparse();
+            SparseMatrixD B = new MatrixXD("2 0;0 1;1 0").ToSparse();
+            var result = A.Mult(B, 0.01);
+
+            Assert.Equal(3, result.Nnz);
+            Assert.Equal(new MatrixXD("2 0;0 1;3.004 0"), result.ToDense());
+            Assert.Equal(A.Mult(B), A.Mult(B, 0.0));
+        }
+
+        [Fact]
+        public void MultMultithreaded_ShouldMatchSingleThreaded()
+        {
+            var elements = new List<(int, int, double)>();
+            for (int i = 0; i < 4000; i++)
+            {
+                elements.Add((i, i, 4.0));
+                elements.Add((i, (i * 7 + 3) % 4000, 1.0 + i % 5));
+                elements.Add(((i * 13 + 5) % 4000, i, -0.5));
+            }
+
+            SparseMatrixD A = new SparseMatrixD(elements, 4000, 4000);
+            SparseMatrixD expected;
+            using (EigenThreads.Budget(1))
+            {
+                expected = A.Mult(A);
+            }
+
+            using (EigenThreads.Budget(4))
+            {
+                Assert.Equal(expected, A.Mult(A));
+            }
         }
 
         [Fact]
@@ -295,6 +366,31 @@ namespace EigenCore.Test.Core.Sparse
             Assert.Equal(new double[] { 17.0, -29.0, 26.0 }, result.GetValues().ToArray());
         }
 
+        [Fact]
+        public void CreateMultiplier_ShouldSucceed()
+        {
+            SparseMatrixD A = new MatrixXD("1 -2 ; 2 5 ; 4 -2").ToSparse();
+            using (SparseMatrixVectorProduct multiplier = A.CreateMultiplier())
+            {
+                var result = multiplier.Mult(new VectorXD(new[] { 3.0, -7.0 }));
+                Assert.Equal(new double[] { 17.0, -29.0, 26.0 }, result.GetValues().ToArray());
+            }
+
+            // large enough to be split across threads.
+            A = SparseMatrixD.Random(400, 300, 0.25, -1, 1, 7);
+            VectorXD v = VectorXD.Random(300, -1, 1, 7);
+            double[] expected = A.Mult(v).GetValues().ToArray();
+            using (SparseMatrixVectorProduct multiplier = A.CreateMultiplier())
+            using (EigenThreads.Budget(4))
+            {
+                double[] result = multiplier.Mult(v).GetValues().ToArray();
+                for (int i = 0; i < expected.Length; i++)
+                {
+                    Assert.Equal(expected[i], result[i], DoublePrecision);
+                }
+            }
+        }
+
         [Fact]
         public void ConjugateGradient_ShouldSucced()
         {
@@ -323,6 +419,231 @@ namespace EigenCore.Test.Core.Sparse
             Assert.Equal(0.00077389987808970792, result.Error, DoublePrecision);
         }
 
+        [InlineData(IterativeSolverType.ConjugateGradient)]
+        [InlineData(IterativeSolverType.BiCGSTAB)]
+        [InlineData(IterativeSolverType.LeastSquaresConjugateGradient)]
+        [InlineData(IterativeSolverType.GMRES)]
+        [InlineData(IterativeSolverType.DGMRES)]
+        [InlineData(IterativeSolverType.MINRES)]
+        [Theory]
+        public void IterativeSolve_InitialGuess_ShouldSucceed(IterativeSolverType iterativeSolverType)
+        {
+            var A = new SparseMatrixD(new (int, int, double)[]
+            {
+                (0, 0, 6), (0, 1, 4),
+                (1, 0, 4), (1, 1, 4), (1, 2, 1),
+                (2, 1, 1), (2, 2, 8)
+            }, 3, 3);
+            var rhs = new VectorXD("10 9 9");
+            var result = A.IterativeSolve(rhs, new IterativeSolverInfo(iterativeSolverType, initialGuess: new VectorXD("1 1 1")));
+            Assert.True(result.Success);
+            Assert.Equal(0, result.Interations);
+            Assert.Equal(new VectorXD("1 1 1"), result.Result);
+
+            result = A.IterativeSolve(rhs, new IterativeSolverInfo(iterativeSolverType, initialGuess: new VectorXD("1 1 1.5")));
+            Assert.True(result.Success);
+            Assert.Equal(new VectorXD("1 1 1"), result.Result);
+        }
+
+        [InlineData(IterativeSolverType.ConjugateGradient, PreconditionerType.Identity)]
+        [InlineData(IterativeSolverType.ConjugateGradient, PreconditionerType.IncompleteCholesky)]
+        [InlineData(IterativeSolverType.BiCGSTAB, PreconditionerType.IncompleteLUT)]
+        [InlineData(IterativeSolverType.BiCGSTAB, PreconditionerType.IncompleteCholesky)]
+        [InlineData(IterativeSolverType.GMRES, PreconditionerType.IncompleteLUT)]
+        [InlineData(IterativeSolverType.MINRES, PreconditionerType.Diagonal)]
+        [InlineData(IterativeSolverType.MINRES, PreconditionerType.IncompleteCholesky)]
+        [InlineData(IterativeSolverType.LeastSquaresConjugateGradient, PreconditionerType.Identity)]
+        [Theory]
+        public void IterativeSolve_Preconditioner_ShouldSucceed(IterativeSolverType iterativeSolverType, PreconditionerType preconditionerType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            var rhs = new VectorXD("3 3 4");
+            var result = A.IterativeSolve(rhs, new IterativeSolverInfo(iterativeSolverType, preconditioner: preconditionerType));
+            Assert.True(result.Success);
+            Assert.Equal(new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558"), result.Result);
+        }
+
+        [Fact]
+        public void CreateIterativeSolver_ShouldSucceed()
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            using var solver = A.CreateIterativeSolver(new IterativeSolverInfo(IterativeSolverType.ConjugateGradient,
+                preconditioner: PreconditionerType.IncompleteCholesky, shift: 1e-3));
+            Assert.True(solver.Success);
+
+            var result = solver.Solve(new VectorXD("3 3 4"));
+            Assert.True(result.Success);
+            Assert.Equal(new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558"), result.Result);
+            Assert.Equal(new VectorXD("1 1 1"), solver.Solve(new VectorXD("10 9 9")).Result);
+
+            A.Scale(2.0);
+            Assert.True(solver.Compute(A));
+            Assert.Equal(new VectorXD("0.5 0.5 0.5"), solver.Solve(new VectorXD("10 9 9")).Result);
+        }
+
+        private static SparseMatrixD Laplacian1D(int size)
+        {
+            var elements = new List<(int, int, double)>();
+            for (int i = 0; i < size; i++)
+            {
+                elements.Add((i, i, 2));
+                if (i > 0) elements.Add((i, i - 1, -1));
+                if (i + 1 < size) elements.Add((i, i + 1, -1));
+            }
+
+            return new SparseMatrixD(elements, size, size);
+        }
+
+        [InlineData(IterativeSolverType.ConjugateGradient)]
+        [InlineData(IterativeSolverType.BiCGSTAB)]
+        [InlineData(IterativeSolverType.LeastSquaresConjugateGradient)]
+        [InlineData(IterativeSolverType.GMRES)]
+        [InlineData(IterativeSolverType.MINRES)]
+        [Theory]
+        public void IterativeSolve_ResidualHistory_ShouldSucceed(IterativeSolverType iterativeSolverType)
+        {
+            var A = Laplacian1D(100);
+            var rhs = VectorXD.Ones(100);
+
+            var result = A.IterativeSolve(rhs, new IterativeSolverInfo(iterativeSolverType, tolerance: 1e-10,
+                preconditioner: PreconditionerType.Identity, recordHistory: true, progressInterval: 5));
+            Assert.False(result.Stopped);
+            Assert.True(result.ResidualHistory.Count > 2);
+
+            var (lastIteration, lastResidual) = result.ResidualHistory[result.ResidualHistory.Count - 1];
+            Assert.Equal(result.Interations, lastIteration);
+            Assert.Equal(A.RelativeError(rhs, result.Result), lastResidual, DoublePrecision);
+            for (int i = 1; i < result.ResidualHistory.Count; i++)
+            {
+                Assert.True(result.ResidualHistory[i].Iteration > result.ResidualHistory[i - 1].Iteration);
+            }
+
+            if (iterativeSolverType != IterativeSolverType.GMRES)
+            {
+                Assert.Equal(5, result.ResidualHistory[0].Iteration);
+            }
+
+            Assert.True(lastResidual < result.ResidualHistory[0].Residual);
+            Assert.Empty(A.IterativeSolve(rhs, new IterativeSolverInfo(iterativeSolverType)).ResidualHistory);
+        }
+
+        [Fact]
+        public void IterativeSolve_Progress_ShouldStop()
+        {
+            var A = Laplacian1D(100);
+            var rhs = VectorXD.Ones(100);
+
+            var calls = new List<(int, double)>();
+            var info = new IterativeSolverInfo(IterativeSolverType.BiCGSTAB, preconditioner: PreconditionerType.Identity,
+                recordHistory: true, progressInterval: 3, progress: (iteration, residual) =>
+                {
+                    calls.Add((iteration, residual));
+                    return iteration < 9;
+                });
+
+            var result = A.IterativeSolve(rhs, info);
+            Assert.False(result.Success);
+            Assert.True(result.Stopped);
+            Assert.Equal(9, result.Interations);
+            Assert.Equal(new[] { 3, 6, 9 }, calls.ConvertAll(call => call.Item1));
+            Assert.Equal(calls, result.ResidualHistory);
+            Assert.Equal(A.RelativeError(rhs, result.Result), result.Error, DoublePrecision);
+
+            using var solver = A.CreateIterativeSolver(new IterativeSolverInfo(IterativeSolverType.ConjugateGradient,
+                progress: (iteration, residual) => throw new ArgumentException()));
+            Assert.Throws<InvalidOperationException>(() => solver.Solve(rhs));
+        }
+
+        [InlineData(EigenvalueSelection.Largest)]
+        [InlineData(EigenvalueSelection.Smallest)]
+        [InlineData(EigenvalueSelection.NearestSigma)]
+        [Theory]
+        public void Eigs_Symmetric_ShouldSucceed(EigenvalueSelection which)
+        {
+            const int size = 100;
+            var A = Laplacian1D(size);
+            var result = A.Eigs(4, which, sigma: 0.5);
+            Assert.True(result.Success);
+            Assert.True(result.Symmetric);
+            Assert.Equal(4, result.Converged);
+
+            // eigenvalues 2 - 2 cos(j pi / (size + 1)), j = 1..size
+            var expected = new List<double>();
+            for (int j = 1; j <= size; j++)
+            {
+                expected.Add(2 - 2 * Math.Cos(j * Math.PI / (size + 1)));
+            }
+
+            expected.Sort((a, b) => which == EigenvalueSelection.Largest ? b.CompareTo(a)
+                : which == EigenvalueSelection.Smallest ? a.CompareTo(b)
+                : Math.Abs(a - 0.5).CompareTo(Math.Abs(b - 0.5)));
+
+            VectorXD values = result.Eigenvalues.Real();
+            MatrixXD vectors = result.Eigenvectors.Real();
+            for (int i = 0; i < 4; i++)
+            {
+                Assert.Equal(expected[i], values.Get(i), 8);
+                Assert.Equal(0, result.Eigenvalues.Imag().Get(i));
+                VectorXD x = vectors.Col(i);
+                Assert.True(A.Mult(x).Minus(x.Scale(values.Get(i))).Norm() < 1e-8);
+            }
+        }
+
+        [Fact]
+        public void Eigs_General_ShouldSucceed()
+        {
+            // a rotation block with eigenvalues 5 +- 2i coupled to a non-normal tridiagonal block
+            // with eigenvalues 2 - 2 sqrt(0.64 * 1.0) cos(j pi / 41) = 2 - 1.6 cos(j pi / 41).
+            var elements = new List<(int, int, double)> { (0, 0, 5), (0, 1, 2), (1, 0, -2), (1, 1, 5), (0, 2, 0.5) };
+            for (int i = 2; i < 42; i++)
+            {
+                elements.Add((i, i, 2));
+                if (i > 2) elements.Add((i, i - 1, -0.64));
+                if (i + 1 < 42) elements.Add((i, i + 1, -1.0));
+            }
+
+            var A = new SparseMatrixD(elements, 42, 42);
+            var result = A.Eigs(3, EigenvalueSelection.Largest);
+            Assert.True(result.Success);
+            Assert.False(result.Symmetric);
+            Assert.Equal(5, result.Eigenvalues.Real().Get(0), 8);
+            Assert.Equal(2, Math.Abs(result.Eigenvalues.Imag().Get(0)), 8);
+            Assert.Equal(-result.Eigenvalues.Imag().Get(0), result.Eigenvalues.Imag().Get(1), 8);
+            Assert.Equal(2 + 1.6 * Math.Cos(Math.PI / 41), result.Eigenvalues.Real().Get(2), 8);
+
+            var nearest = A.Eigs(1, EigenvalueSelection.NearestSigma, sigma: 1);
+            Assert.True(nearest.Success);
+            Assert.Equal(2 - 1.6 * Math.Cos(12 * Math.PI / 41), nearest.Eigenvalues.Real().Get(0), 8);
+
+            var diagonal = new MatrixXD("1 0 0;0 2 0;0 0 3").ToSparse();
+            Assert.Equal(ComputationInfo.NumericalIssue, diagonal.Eigs(1, EigenvalueSelection.NearestSigma, sigma: 2).Info);
+            Assert.Throws<ArgumentOutOfRangeException>(() => A.Eigs(43));
+        }
+
+        [Theory]
+        [InlineData(400, 150)]
+        [InlineData(150, 400)]
+        public void Svds_ShouldSucceed(int rows, int cols)
+        {
+            var A = SparseMatrixD.Random(rows, cols, 0.05, -1, 1);
+            MatrixXD dense = A.ToDense();
+            VectorXD expected = dense.SVD(SVDType.BdcSvd).S;
+
+            var result = A.Svds(6);
+            Assert.True(result.Success);
+            Assert.Equal(rows, result.U.Rows);
+            Assert.Equal(cols, result.V.Rows);
+            for (int i = 0; i < 6; i++)
+            {
+                Assert.Equal(expected.Get(i), result.S.Get(i), 8);
+            }
+
+            MatrixXD S = MatrixXD.Diag(result.S.GetValues().ToArray());
+            Assert.True(dense.Mult(result.V).Minus(result.U.Mult(S)).Norm() <= 1e-8 * expected.Get(0));
+            Assert.True(dense.Transpose().Mult(result.U).Minus(result.V.Mult(S)).Norm() <= 1e-8 * expected.Get(0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => A.Svds(151));
+        }
+
         [Fact]
         public void BiCGSTAB_ShouldSucced()
         {
@@ -507,6 +828,95 @@ namespace EigenCore.Test.Core.Sparse
             Assert.Equal(new VectorXD("0.45833333333333331 -0.24999999999999994 0.41666666666666663"), result);
         }
 
+        [InlineData(DirectSolverType.MixedPrecisionSparseLU)]
+        [InlineData(DirectSolverType.MixedPrecisionSimplicialLDLT)]
+        [Theory]
+        public void DirectSolveMixedPrecision_ShouldSucceed(DirectSolverType directSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            var rhs = new VectorXD("3 3 4");
+            var expected = new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558");
+            var result = A.DirectSolveMixedPrecision(rhs, directSolverType);
+            Assert.True(result.Converged);
+            Assert.InRange(result.RefinementSteps, 1, 5);
+            Assert.Equal(expected, result.Result);
+            Assert.Equal(expected, A.DirectSolve(rhs, directSolverType));
+        }
+
+        [InlineData(DirectSolverType.SimplicialLLT)]
+        [InlineData(DirectSolverType.SimplicialLDLT)]
+        [InlineData(DirectSolverType.SparseLU)]
+        [InlineData(DirectSolverType.SparseQR)]
+        [Theory]
+        public void SolveBlock_ShouldSucceed(DirectSolverType directSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            var rhs = new MatrixXD("3 1; 3 0; 4 -0.5");
+            MatrixXD result = A.DirectSolve(rhs, directSolverType);
+            Assert.Equal(new MatrixXD("0.22413793103448287 0.5; 0.41379310344827569 -0.5; 0.44827586206896558 0"), result);
+        }
+
+        [InlineData(DirectSolverType.SimplicialLLT)]
+        [InlineData(DirectSolverType.SimplicialLDLT)]
+        [InlineData(DirectSolverType.SparseLU)]
+        [InlineData(DirectSolverType.SparseQR)]
+        [Theory]
+        public void Factorize_ShouldSucceed(DirectSolverType directSolverType)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            using var factorization = A.Factorize(directSolverType);
+            Assert.True(factorization.Success);
+            Assert.Equal(new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558"), factorization.Solve(new VectorXD("3 3 4")));
+            Assert.Equal(new VectorXD("0.5 -0.5 0"), factorization.Solve(new VectorXD("1 0 -0.5")));
+            Assert.Equal(new MatrixXD("0.22413793103448287 0.5; 0.41379310344827569 -0.5; 0.44827586206896558 0"),
+                factorization.Solve(new MatrixXD("3 1; 3 0; 4 -0.5")));
+
+            A.Scale(2.0);
+            Assert.True(factorization.Factorize(A));
+            Assert.Equal(new VectorXD("0.11206896551724144 0.20689655172413784 0.22413793103448279"), factorization.Solve(new VectorXD("3 3 4")));
+        }
+
+        [InlineData(DirectSolverType.SimplicialLLT, SparseOrdering.AMD)]
+        [InlineData(DirectSolverType.SimplicialLDLT, SparseOrdering.AMD)]
+        [InlineData(DirectSolverType.SparseLU, SparseOrdering.COLAMD)]
+        [InlineData(DirectSolverType.SparseQR, SparseOrdering.COLAMD)]
+        [Theory]
+        public void DirectSolveWithStats_ShouldSucceed(DirectSolverType directSolverType, SparseOrdering ordering)
+        {
+            var A = new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse();
+            DirectSolverResult result = A.DirectSolveWithStats(new VectorXD("3 3 4"), directSolverType);
+            Assert.True(result.Success);
+            Assert.Equal(new VectorXD("0.22413793103448287 0.41379310344827569 0.44827586206896558"), result.Result);
+
+            DirectSolverStats stats = result.Stats;
+            Assert.Equal(ComputationInfo.Success, stats.Info);
+            Assert.Equal(ordering, stats.Ordering);
+            Assert.True(stats.NnzL >= 5 && stats.NnzU >= 5);
+            Assert.True(stats.WorkspaceBytes > 0);
+            Assert.True(stats.OrderingTime >= TimeSpan.Zero && stats.SymbolicTime >= TimeSpan.Zero && stats.NumericTime >= TimeSpan.Zero);
+            Assert.True(stats.TotalTime >= stats.NumericTime);
+
+            using var factorization = A.Factorize(directSolverType);
+            Assert.Equal(ordering, factorization.Stats.Ordering);
+            Assert.Equal(stats.NnzL, factorization.Stats.NnzL);
+        }
+
+        [Fact]
+        public void DirectSolveWithStats_ShouldReportNumericalIssue()
+        {
+            var singular = new MatrixXD("1 2 0;2 4 0;0 0 1").ToSparse();
+            DirectSolverResult result = singular.DirectSolveWithStats(new VectorXD("1 1 1"), DirectSolverType.SparseLU);
+            Assert.False(result.Success);
+            Assert.Equal(ComputationInfo.NumericalIssue, result.Stats.Info);
+
+            var indefinite = new MatrixXD("1 2 0;2 1 0;0 0 1").ToSparse();
+            result = indefinite.DirectSolveWithStats(new VectorXD("1 1 1"), DirectSolverType.SimplicialLLT);
+            Assert.Equal(ComputationInfo.NumericalIssue, result.Stats.Info);
+            Assert.Equal(0, result.Stats.NnzL);
+
+            Assert.Throws<ArgumentException>(() => singular.DirectSolveWithStats(new VectorXD("1 1 1"), DirectSolverType.MixedPrecisionSparseLU));
+        }
+
         [Fact]
         public void LeastSquares_ShouldSucceed()
         {
@@ -0,0 +1,54 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Core.Sparse;
+using EigenCore.Core.Sparse.LinearAlgebra;
+using Xunit;
+
+namespace EigenCore.Test.Core.Sparse
+{
+    public class SparseMatrixFTest
+    {
+        public const int FloatPrecision = 5;
+
+        [Fact]
+        public void SparseOperations_ShouldSucceed()
+        {
+            var A = new SparseMatrixF(new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse());
+            var I = SparseMatrixF.Identity(3);
+            Assert.Equal(new SparseMatrixF(new MatrixXD("7 4 0;4 5 1;0 1 9").ToSparse()), A.Add(I));
+            Assert.Equal(new SparseMatrixF(new MatrixXD("5 4 0;4 3 1;0 1 7").ToSparse()), A.Minus(I));
+            Assert.Equal(new VectorXF("10 9 9"), A.Mult(VectorXF.Ones(3)));
+            Assert.Equal(A, A.Transpose());
+            Assert.Equal(150, A.SquaredNorm(), FloatPrecision);
+            Assert.Equal(A.ToDouble().Norm(), A.Norm(), FloatPrecision);
+        }
+
+        [InlineData(DirectSolverType.SimplicialLLT)]
+        [InlineData(DirectSolverType.SimplicialLDLT)]
+        [InlineData(DirectSolverType.SparseLU)]
+        [InlineData(DirectSolverType.SparseQR)]
+        [Theory]
+        public void DirectSolve_ShouldSucceed(DirectSolverType directSolverType)
+        {
+            var A = new SparseMatrixF(new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse());
+            Assert.Equal(new VectorXF("1 1 1"), A.DirectSolve(new VectorXF("10 9 9"), directSolverType));
+        }
+
+        [InlineData(IterativeSolverType.ConjugateGradient)]
+        [InlineData(IterativeSolverType.BiCGSTAB)]
+        [InlineData(IterativeSolverType.LeastSquaresConjugateGradient)]
+        [InlineData(IterativeSolverType.GMRES)]
+        [InlineData(IterativeSolverType.MINRES)]
+        [Theory]
+        public void IterativeSolve_ShouldSucceed(IterativeSolverType iterativeSolverType)
+        {
+            var A = new SparseMatrixF(new MatrixXD("6 4 0;4 4 1;0 1 8").ToSparse());
+            var result = A.IterativeSolve(new VectorXF("10 9 9"), new IterativeSolverInfo(iterativeSolverType, tolerance: 1e-6));
+            Assert.True(result.Success);
+            Assert.Equal(0, A.ToDouble().AbsoluteError(new VectorXD("10 9 9"), result.Result.ToDouble()), 4);
+
+            result = A.IterativeSolve(new VectorXF("10 9 9"), new IterativeSolverInfo(iterativeSolverType, initialGuess: new VectorXD("1 1 1")));
+            Assert.True(result.Success);
+            Assert.Equal(0, result.Interations);
+        }
+    }
+}
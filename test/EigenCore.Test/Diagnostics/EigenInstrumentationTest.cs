@@ -0,0 +1,83 @@
+﻿using EigenCore.Core.Dense;
+using EigenCore.Diagnostics;
+using System;
+using System.Linq;
+using System.Threading;
+using Xunit;
+
+namespace EigenCore.Test.Diagnostics
+{
+    public class EigenInstrumentationTest
+    {
+        // no other test takes the L-inf norm of a vector this long, size bucket [4^9, 4^10).
+        private const int Length = 300000;
+
+        private static EntryPointStatistics Find()
+        {
+            return EigenInstrumentation.Snapshot().SingleOrDefault(e => e.Name == "dvlpinf_norm_" && e.SizeBucket == 9);
+        }
+
+        [Fact]
+        public void Snapshot_ShouldMergeThreads()
+        {
+            Assert.True(EigenInstrumentation.Enabled);
+            EigenInstrumentation.Reset();
+            Assert.Null(Find());
+
+            VectorXD v = new VectorXD(Enumerable.Range(0, Length).Select(i => (double)(i % 101)).ToArray());
+            for (int i = 0; i < 3; i++)
+            {
+                Assert.Equal(100, v.LpInfNorm());
+            }
+
+            // the counts of a thread are kept after it exits.
+            var thread = new Thread(() => v.LpInfNorm());
+            thread.Start();
+            thread.Join();
+
+            EntryPointStatistics stats = Find();
+            Assert.Equal(4, stats.Count);
+            Assert.Equal(4, stats.Histogram.Sum());
+            Assert.Equal(EigenInstrumentation.LatencyBuckets, stats.Histogram.Count);
+            Assert.InRange(Length, stats.MinSize, stats.MaxSize - 1);
+            Assert.True(stats.MinNanoseconds > 0);
+            Assert.True(stats.MinNanoseconds <= stats.MaxNanoseconds);
+            Assert.True(stats.MaxNanoseconds <= stats.TotalNanoseconds);
+
+            EigenInstrumentation.Reset();
+            Assert.Null(Find());
+            v.LpInfNorm();
+            Assert.Equal(1, Find().Count);
+        }
+
+        [Fact]
+        public void Disabled_ShouldNotRecord()
+        {
+            VectorXD v = new VectorXD(new double[Length]);
+            EigenInstrumentation.Reset();
+            EigenInstrumentation.Enabled = false;
+            try
+            {
+                Assert.False(EigenInstrumentation.Enabled);
+                v.LpInfNorm();
+                Assert.Null(Find());
+            }
+            finally
+            {
+                EigenInstrumentation.Enabled = true;
+            }
+
+            v.LpInfNorm();
+            Assert.Equal(1, Find().Count);
+        }
+
+        [Fact]
+        public void LatencyUpperBound_ShouldDouble()
+        {
+            Assert.Equal(TimeSpan.FromTicks(20), EntryPointStatistics.LatencyUpperBound(0));
+            Assert.Equal(TimeSpan.FromTicks(40), EntryPointStatistics.LatencyUpperBound(1));
+            Assert.Equal(TimeSpan.MaxValue, EntryPointStatistics.LatencyUpperBound(EigenInstrumentation.LatencyBuckets - 1));
+            Assert.Throws<ArgumentOutOfRangeException>(() => EntryPointStatistics.LatencyUpperBound(EigenInstrumentation.LatencyBuckets));
+        }
+    }
+}